@@ -0,0 +1,128 @@
+//
+//  HRRuntimeEnum.h
+//  HRSmartEnum
+//
+//  Copyright (c) 2013 Sibers. All rights reserved.
+//  Released under the MIT license.
+//
+
+#import <Foundation/Foundation.h>
+#import "HRSmartEnum.h"
+
+
+#pragma mark -
+#pragma mark Metadata file format
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Enums which are defined by configuration rather than code can be loaded at runtime from a compact binary metadata
+// file. The file is memory-mapped and all lookups are served directly from the mapped pages.
+//
+// The file consists of the following parts (all integers are in the native byte order, offsets are counted from
+// the beginning of the file):
+//  * HRRuntimeEnumHeader,
+//  * HRRuntimeEnumEntry for every enum constant in the order of declaration (i.e. indexed by ordinal), 8-byte aligned,
+//  * uint32_t ordinals of the enum constants sorted by name (bytewise comparison of the UTF-8 names),
+//  * uint32_t ordinals of the enum constants sorted by value,
+//  * UTF-8 strings: the class name, the enum constant names and descriptions, each followed by a NUL byte which is
+//     not included in the corresponding length.
+//
+// Such files can be created with +[HRRuntimeEnum dataWithClassName:names:values:descriptions:].
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_RUNTIME_ENUM_MAGIC   "HREN"
+#define HR_RUNTIME_ENUM_VERSION 1
+
+typedef struct
+{
+    char     magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t classNameOffset;
+    uint32_t classNameLength;
+    uint32_t entriesOffset;
+    uint32_t namesIndexOffset;
+    uint32_t valuesIndexOffset;
+} HRRuntimeEnumHeader;
+
+typedef struct
+{
+    int64_t  value;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t descriptionOffset;
+    uint32_t descriptionLength;
+} HRRuntimeEnumEntry;
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Errors
+
+extern NSString * const HRRuntimeEnumErrorDomain;
+
+typedef NS_ENUM(NSInteger, HRRuntimeEnumError)
+{
+    HRRuntimeEnumErrorFileNotReadable = 1,
+    HRRuntimeEnumErrorInvalidFormat,
+    HRRuntimeEnumErrorClassExists
+};
+
+
+
+
+
+#pragma mark -
+#pragma mark HRRuntimeEnum
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Creates enum classes from the metadata files at runtime.
+//
+// The created class is a subclass of NSObject and provides the same methods as the classes declared with HR_ENUM:
+//  * a class method + (NSInteger) Value1 and a readonly property Value1 for every enum constant,
+//  * + and - versions of asDictionary, allKeys, allValues and descriptionForValue,
+//  * + and - versions of valueForKey: which look the enum constant names up in the mapped names index.
+//
+// Since the enum constants are not known at compile time, you'd have to access them through valueForKey: or
+// performSelector: or declare a category with the expected methods.
+//
+// Methods for the enum constants are added lazily on the first call through +resolveClassMethod: and
+// +resolveInstanceMethod:, and dictionary representations are built on the first access, so loading the class
+// only validates the file and takes time proportional to the number of constants with a very small constant factor.
+//
+// Mapped files are never unmapped since the created classes cannot be disposed of. The created classes are not
+// meant to be subclassed, but instances of them can be observed with KVO (which creates a subclass at runtime).
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+@interface HRRuntimeEnum : NSObject
+
+// Maps the given metadata file and creates the enum class described in it. Returns Nil and sets the error
+// if the file cannot be read, has invalid format or a class with the same name already exists.
++ (Class) enumClassWithContentsOfFile: (NSString *) path error: (NSError **) error;
+
+// Creates the contents of a metadata file. names and descriptions are arrays of NSStrings, values is an array of
+// NSNumbers; all of them should have the same number of elements. Returns nil if any of the names is empty or
+// the names or values have duplicates, since such files would be rejected by +enumClassWithContentsOfFile:error:.
++ (NSData *) dataWithClassName: (NSString *) className
+                         names: (NSArray *) names
+                        values: (NSArray *) values
+                  descriptions: (NSArray *) descriptions;
+
+@end
+
+
+
+
+
+#pragma mark -
+#pragma mark Zero-copy lookups
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Plain C lookups for the classes created by HRRuntimeEnum which do not create any objects.
+//
+// Strings returned point directly to the mapped file; bytes field is NULL if there is no such enum constant.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+extern NSUInteger        HRRuntimeEnumCount(Class enumClass);
+extern BOOL              HRRuntimeEnumValueForName(Class enumClass, const char *name, size_t length, NSInteger *value);
+extern HRSmartEnumString HRRuntimeEnumNameForValue(Class enumClass, NSInteger value);
+extern HRSmartEnumString HRRuntimeEnumDescriptionForValue(Class enumClass, NSInteger value);
@@ -0,0 +1,718 @@
+//
+//  HRRuntimeEnum.m
+//  HRSmartEnum
+//
+//  Copyright (c) 2013 Sibers. All rights reserved.
+//  Released under the MIT license.
+//
+
+#import "HRRuntimeEnum.h"
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <fcntl.h>
+#import <unistd.h>
+
+
+NSString * const HRRuntimeEnumErrorDomain = @"HRRuntimeEnumErrorDomain";
+
+
+// Marker class method added to the created classes, see HRRuntimeEnumGetClass.
+@protocol HRRuntimeEnumMarker
++ (Class) hr_runtimeEnumClass;
+@end
+
+
+#pragma mark -
+#pragma mark Metadata
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Dictionary and array representations of an enum class which are built on the first access.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    CFTypeRef asDictionary;
+    CFTypeRef descriptionForValue;
+    CFTypeRef allKeys;
+    CFTypeRef allValues;
+} HRRuntimeEnumCollections;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Runtime representation of a mapped metadata file.
+//
+// A pointer to this structure is stored in the indexed ivars of the created class (see objc_allocateClassPair),
+// so the method implementations can get to it without any lookups once they know the created class.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    const uint8_t             *bytes;
+    size_t                     length;
+    const HRRuntimeEnumHeader *header;
+    const HRRuntimeEnumEntry  *entries;
+    const uint32_t            *namesIndex;
+    const uint32_t            *valuesIndex;
+
+    HRRuntimeEnumCollections  *collections;
+} HRRuntimeEnumMetadata;
+
+
+// Returns the class created by enumClassWithContentsOfFile: for the given object which may be that class, its
+// subclass or an instance of either of them.
+//
+// Subclasses (including the ones KVO creates for observed instances) do not have the indexed ivars of the created
+// class, so the created class is returned by the +hr_runtimeEnumClass marker method which they inherit.
+static Class HRRuntimeEnumGetClass(id object)
+{
+    Class theClass = class_isMetaClass(object_getClass(object)) ? (Class)object : object_getClass(object);
+    IMP   marker   = class_getMethodImplementation(object_getClass(theClass), @selector(hr_runtimeEnumClass));
+
+    return ((Class (*)(id, SEL))marker)(theClass, @selector(hr_runtimeEnumClass));
+}
+
+
+static HRRuntimeEnumMetadata *HRRuntimeEnumGetMetadata(id object)
+{
+    return *(HRRuntimeEnumMetadata **)object_getIndexedIvars(HRRuntimeEnumGetClass(object));
+}
+
+
+static NSComparisonResult HRRuntimeEnumCompareNames(const uint8_t *bytes1, size_t length1,
+                                                    const uint8_t *bytes2, size_t length2)
+{
+    int result = memcmp(bytes1, bytes2, MIN(length1, length2));
+
+    if (result != 0)
+    {
+        return (result < 0) ? NSOrderedAscending : NSOrderedDescending;
+    }
+
+    return (length1 == length2) ? NSOrderedSame : ((length1 < length2) ? NSOrderedAscending : NSOrderedDescending);
+}
+
+
+// Binary search of the enum constant by name in the names index. Returns ordinal or NSNotFound.
+static NSUInteger HRRuntimeEnumOrdinalForName(const HRRuntimeEnumMetadata *metadata, const char *name, size_t length)
+{
+    NSUInteger low  = 0;
+    NSUInteger high = metadata->header->count;
+
+    while (low < high)
+    {
+        NSUInteger middle  = low + (high-low)/2;
+        uint32_t   ordinal = metadata->namesIndex[middle];
+
+        const HRRuntimeEnumEntry *entry = &metadata->entries[ordinal];
+
+        NSComparisonResult result = HRRuntimeEnumCompareNames(metadata->bytes + entry->nameOffset, entry->nameLength,
+                                                              (const uint8_t *)name, length);
+
+        if (result == NSOrderedSame)
+        {
+            return ordinal;
+        }
+        else if (result == NSOrderedAscending)
+        {
+            low = middle+1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return NSNotFound;
+}
+
+
+// Binary search of the enum constant by value in the values index. Returns ordinal or NSNotFound.
+static NSUInteger HRRuntimeEnumOrdinalForValue(const HRRuntimeEnumMetadata *metadata, NSInteger value)
+{
+    NSUInteger low  = 0;
+    NSUInteger high = metadata->header->count;
+
+    while (low < high)
+    {
+        NSUInteger middle  = low + (high-low)/2;
+        uint32_t   ordinal = metadata->valuesIndex[middle];
+        int64_t    current = metadata->entries[ordinal].value;
+
+        if (current == value)
+        {
+            return ordinal;
+        }
+        else if (current < value)
+        {
+            low = middle+1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return NSNotFound;
+}
+
+
+static NSString *HRRuntimeEnumString(const HRRuntimeEnumMetadata *metadata, uint32_t offset, uint32_t length)
+{
+    NSString *string = [[NSString alloc] initWithBytesNoCopy: (void *)(metadata->bytes + offset)
+                                                      length: length
+                                                    encoding: NSUTF8StringEncoding
+                                                freeWhenDone: NO];
+    return string ?: @"";
+}
+
+
+// Returns the collections of the enum class building them on the first call, or NULL if they cannot be allocated.
+//
+// Metadata is allocated dynamically, so the collections are installed with a compare-and-swap rather than with
+// dispatch_once (which requires a predicate with static or global storage). Threads which lose the race release
+// the collections they have built and return the installed ones.
+static const HRRuntimeEnumCollections *HRRuntimeEnumGetCollections(HRRuntimeEnumMetadata *metadata)
+{
+    HRRuntimeEnumCollections *collections = __atomic_load_n(&metadata->collections, __ATOMIC_ACQUIRE);
+
+    if (collections != NULL)
+    {
+        return collections;
+    }
+
+    collections = malloc(sizeof(HRRuntimeEnumCollections));
+
+    if (collections == NULL)
+    {
+        return NULL;
+    }
+
+    @autoreleasepool
+    {
+        NSUInteger count = metadata->header->count;
+
+        NSMutableDictionary *asDictionary        = [NSMutableDictionary dictionaryWithCapacity: count];
+        NSMutableDictionary *descriptionForValue = [NSMutableDictionary dictionaryWithCapacity: count];
+        NSMutableArray      *allKeys             = [NSMutableArray arrayWithCapacity: count];
+        NSMutableArray      *allValues           = [NSMutableArray arrayWithCapacity: count];
+
+        for (NSUInteger ordinal = 0; ordinal < count; ++ordinal)
+        {
+            const HRRuntimeEnumEntry *entry = &metadata->entries[ordinal];
+
+            NSString *name  = HRRuntimeEnumString(metadata, entry->nameOffset, entry->nameLength);
+            NSNumber *value = @(entry->value);
+
+            asDictionary[name]         = value;
+            descriptionForValue[value] = HRRuntimeEnumString(metadata, entry->descriptionOffset,
+                                                             entry->descriptionLength);
+            [allKeys   addObject: name];
+            [allValues addObject: value];
+        }
+
+        collections->asDictionary        = CFBridgingRetain([asDictionary copy]);
+        collections->descriptionForValue = CFBridgingRetain([descriptionForValue copy]);
+        collections->allKeys             = CFBridgingRetain([allKeys copy]);
+        collections->allValues           = CFBridgingRetain([allValues copy]);
+    }
+
+    HRRuntimeEnumCollections *installed = NULL;
+
+    if (__atomic_compare_exchange_n(&metadata->collections, &installed, collections,
+                                    NO, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        return collections;
+    }
+
+    CFRelease(collections->asDictionary);
+    CFRelease(collections->descriptionForValue);
+    CFRelease(collections->allKeys);
+    CFRelease(collections->allValues);
+    free(collections);
+
+    return installed;
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Method implementations
+
+static id HRRuntimeEnumAsDictionary(id SELF, SEL CMD)
+{
+    const HRRuntimeEnumCollections *collections = HRRuntimeEnumGetCollections(HRRuntimeEnumGetMetadata(SELF));
+    return (collections != NULL) ? (__bridge id)collections->asDictionary : nil;
+}
+
+
+static id HRRuntimeEnumDescriptionForValueDictionary(id SELF, SEL CMD)
+{
+    const HRRuntimeEnumCollections *collections = HRRuntimeEnumGetCollections(HRRuntimeEnumGetMetadata(SELF));
+    return (collections != NULL) ? (__bridge id)collections->descriptionForValue : nil;
+}
+
+
+static id HRRuntimeEnumAllKeys(id SELF, SEL CMD)
+{
+    const HRRuntimeEnumCollections *collections = HRRuntimeEnumGetCollections(HRRuntimeEnumGetMetadata(SELF));
+    return (collections != NULL) ? (__bridge id)collections->allKeys : nil;
+}
+
+
+static id HRRuntimeEnumAllValues(id SELF, SEL CMD)
+{
+    const HRRuntimeEnumCollections *collections = HRRuntimeEnumGetCollections(HRRuntimeEnumGetMetadata(SELF));
+    return (collections != NULL) ? (__bridge id)collections->allValues : nil;
+}
+
+
+static id HRRuntimeEnumValueForKey(id SELF, SEL CMD, NSString *key)
+{
+    HRRuntimeEnumMetadata *metadata = HRRuntimeEnumGetMetadata(SELF);
+
+    char       buffer[256];
+    NSUInteger length    = 0;
+    NSUInteger ordinal   = NSNotFound;
+    NSRange    remaining = { 0, 0 };
+
+    if ([key getBytes: buffer maxLength: sizeof(buffer) usedLength: &length encoding: NSUTF8StringEncoding
+              options: 0 range: NSMakeRange(0, key.length) remainingRange: &remaining] && remaining.length == 0)
+    {
+        ordinal = HRRuntimeEnumOrdinalForName(metadata, buffer, length);
+    }
+
+    if (ordinal != NSNotFound)
+    {
+        return @(metadata->entries[ordinal].value);
+    }
+
+    // Start the lookup above the created class rather than above the class of SELF, which may be a subclass whose
+    // superclass implementation is this very function
+    Class enumClass  = HRRuntimeEnumGetClass(SELF);
+    Class superclass = class_getSuperclass(class_isMetaClass(object_getClass(SELF)) ? object_getClass(enumClass)
+                                                                                    : enumClass);
+    struct objc_super superReceiver = { SELF, superclass };
+    return ((id (*)(struct objc_super *, SEL, NSString *))objc_msgSendSuper)(&superReceiver, CMD, key);
+}
+
+
+// Adds a method returning the enum constant value named as the given selector to the given class.
+static BOOL HRRuntimeEnumResolveConstant(id SELF, Class targetClass, SEL selector)
+{
+    HRRuntimeEnumMetadata *metadata = HRRuntimeEnumGetMetadata(SELF);
+
+    const char *name    = sel_getName(selector);
+    NSUInteger  ordinal = HRRuntimeEnumOrdinalForName(metadata, name, strlen(name));
+
+    if (ordinal == NSNotFound)
+    {
+        return NO;
+    }
+
+    NSInteger value = (NSInteger)metadata->entries[ordinal].value;
+    IMP implementation = imp_implementationWithBlock(^NSInteger(id object) {
+        return value;
+    });
+
+    char types[16];
+    snprintf(types, sizeof(types), "%s@:", @encode(NSInteger));
+
+    return class_addMethod(targetClass, selector, implementation, types);
+}
+
+
+static BOOL HRRuntimeEnumResolveClassMethod(id SELF, SEL CMD, SEL selector)
+{
+    return HRRuntimeEnumResolveConstant(SELF, object_getClass(SELF), selector);
+}
+
+
+static BOOL HRRuntimeEnumResolveInstanceMethod(id SELF, SEL CMD, SEL selector)
+{
+    return HRRuntimeEnumResolveConstant(SELF, (Class)SELF, selector);
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Validation
+
+static BOOL HRRuntimeEnumRangeIsValid(size_t length, uint64_t offset, uint64_t size)
+{
+    return (offset <= length) && (size <= length - offset);
+}
+
+
+static BOOL HRRuntimeEnumStringIsValid(size_t length, const uint8_t *bytes, uint32_t offset, uint32_t stringLength)
+{
+    return HRRuntimeEnumRangeIsValid(length, offset, (uint64_t)stringLength + 1) && bytes[offset+stringLength] == 0;
+}
+
+
+static BOOL HRRuntimeEnumValidate(HRRuntimeEnumMetadata *metadata)
+{
+    const uint8_t *bytes  = metadata->bytes;
+    size_t         length = metadata->length;
+
+    if (length < sizeof(HRRuntimeEnumHeader))
+    {
+        return NO;
+    }
+
+    const HRRuntimeEnumHeader *header = (const HRRuntimeEnumHeader *)bytes;
+    uint64_t count = header->count;
+
+    if (memcmp(header->magic, HR_RUNTIME_ENUM_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != HR_RUNTIME_ENUM_VERSION ||
+        header->entriesOffset % __alignof__(HRRuntimeEnumEntry) != 0 ||
+        header->namesIndexOffset % __alignof__(uint32_t) != 0 ||
+        header->valuesIndexOffset % __alignof__(uint32_t) != 0 ||
+        !HRRuntimeEnumRangeIsValid(length, header->entriesOffset, count * sizeof(HRRuntimeEnumEntry)) ||
+        !HRRuntimeEnumRangeIsValid(length, header->namesIndexOffset, count * sizeof(uint32_t)) ||
+        !HRRuntimeEnumRangeIsValid(length, header->valuesIndexOffset, count * sizeof(uint32_t)) ||
+        !HRRuntimeEnumStringIsValid(length, bytes, header->classNameOffset, header->classNameLength))
+    {
+        return NO;
+    }
+
+    metadata->header      = header;
+    metadata->entries     = (const HRRuntimeEnumEntry *)(bytes + header->entriesOffset);
+    metadata->namesIndex  = (const uint32_t *)(bytes + header->namesIndexOffset);
+    metadata->valuesIndex = (const uint32_t *)(bytes + header->valuesIndexOffset);
+
+    for (uint32_t ordinal = 0; ordinal < count; ++ordinal)
+    {
+        const HRRuntimeEnumEntry *entry = &metadata->entries[ordinal];
+
+        if (!HRRuntimeEnumStringIsValid(length, bytes, entry->nameOffset, entry->nameLength) ||
+            !HRRuntimeEnumStringIsValid(length, bytes, entry->descriptionOffset, entry->descriptionLength) ||
+            entry->nameLength == 0)
+        {
+            return NO;
+        }
+    }
+
+    // Both indices have to be sorted without duplicates for binary search to work
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (metadata->namesIndex[i] >= count || metadata->valuesIndex[i] >= count)
+        {
+            return NO;
+        }
+
+        if (i > 0)
+        {
+            const HRRuntimeEnumEntry *previous = &metadata->entries[metadata->namesIndex[i-1]];
+            const HRRuntimeEnumEntry *current  = &metadata->entries[metadata->namesIndex[i]];
+
+            if (HRRuntimeEnumCompareNames(bytes + previous->nameOffset, previous->nameLength,
+                                          bytes + current->nameOffset,  current->nameLength) != NSOrderedAscending ||
+                metadata->entries[metadata->valuesIndex[i-1]].value >= metadata->entries[metadata->valuesIndex[i]].value)
+            {
+                return NO;
+            }
+        }
+    }
+
+    return YES;
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark HRRuntimeEnum
+
+@implementation HRRuntimeEnum
+
++ (Class) enumClassWithContentsOfFile: (NSString *) path error: (NSError **) error
+{
+    NSInteger errorCode = 0;
+    Class     enumClass = Nil;
+
+    int fd = open(path.fileSystemRepresentation, O_RDONLY);
+    struct stat status;
+
+    if (fd < 0 || fstat(fd, &status) != 0 || status.st_size <= 0)
+    {
+        errorCode = HRRuntimeEnumErrorFileNotReadable;
+    }
+
+    void *bytes = MAP_FAILED;
+
+    if (errorCode == 0)
+    {
+        bytes = mmap(NULL, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (bytes == MAP_FAILED)
+        {
+            errorCode = HRRuntimeEnumErrorFileNotReadable;
+        }
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    HRRuntimeEnumMetadata *metadata = NULL;
+
+    if (errorCode == 0)
+    {
+        metadata = calloc(1, sizeof(HRRuntimeEnumMetadata));
+
+        if (metadata == NULL)
+        {
+            errorCode = HRRuntimeEnumErrorFileNotReadable;
+        }
+    }
+
+    if (errorCode == 0)
+    {
+        metadata->bytes  = bytes;
+        metadata->length = (size_t)status.st_size;
+
+        if (!HRRuntimeEnumValidate(metadata))
+        {
+            errorCode = HRRuntimeEnumErrorInvalidFormat;
+        }
+    }
+
+    if (errorCode == 0)
+    {
+        const char *className = (const char *)metadata->bytes + metadata->header->classNameOffset;
+        enumClass = objc_allocateClassPair([NSObject class], className, sizeof(HRRuntimeEnumMetadata *));
+
+        if (enumClass == Nil)
+        {
+            errorCode = HRRuntimeEnumErrorClassExists;
+        }
+    }
+
+    if (errorCode != 0)
+    {
+        if (bytes != MAP_FAILED)
+        {
+            munmap(bytes, (size_t)status.st_size);
+        }
+
+        free(metadata);
+
+        if (error != NULL)
+        {
+            *error = [NSError errorWithDomain: HRRuntimeEnumErrorDomain
+                                         code: errorCode
+                                     userInfo: @{ NSFilePathErrorKey : path }];
+        }
+
+        return Nil;
+    }
+
+    Class metaClass = object_getClass(enumClass);
+
+    class_addMethod(enumClass, @selector(asDictionary),        (IMP)&HRRuntimeEnumAsDictionary,                  "@@:");
+    class_addMethod(enumClass, @selector(descriptionForValue), (IMP)&HRRuntimeEnumDescriptionForValueDictionary, "@@:");
+    class_addMethod(enumClass, @selector(allKeys),             (IMP)&HRRuntimeEnumAllKeys,                       "@@:");
+    class_addMethod(enumClass, @selector(allValues),           (IMP)&HRRuntimeEnumAllValues,                     "@@:");
+    class_addMethod(enumClass, @selector(valueForKey:),        (IMP)&HRRuntimeEnumValueForKey,                   "@@:@");
+
+    class_addMethod(metaClass, @selector(asDictionary),        (IMP)&HRRuntimeEnumAsDictionary,                  "@@:");
+    class_addMethod(metaClass, @selector(descriptionForValue), (IMP)&HRRuntimeEnumDescriptionForValueDictionary, "@@:");
+    class_addMethod(metaClass, @selector(allKeys),             (IMP)&HRRuntimeEnumAllKeys,                       "@@:");
+    class_addMethod(metaClass, @selector(allValues),           (IMP)&HRRuntimeEnumAllValues,                     "@@:");
+    class_addMethod(metaClass, @selector(valueForKey:),        (IMP)&HRRuntimeEnumValueForKey,                   "@@:@");
+
+    char resolveTypes[16];
+    snprintf(resolveTypes, sizeof(resolveTypes), "%s@::", @encode(BOOL));
+
+    class_addMethod(metaClass, @selector(resolveClassMethod:),    (IMP)&HRRuntimeEnumResolveClassMethod,    resolveTypes);
+    class_addMethod(metaClass, @selector(resolveInstanceMethod:), (IMP)&HRRuntimeEnumResolveInstanceMethod, resolveTypes);
+
+    IMP marker = imp_implementationWithBlock(^Class(id object) {
+        return enumClass;
+    });
+
+    class_addMethod(metaClass, @selector(hr_runtimeEnumClass), marker, "#@:");
+
+    *(HRRuntimeEnumMetadata **)object_getIndexedIvars(enumClass) = metadata;
+    objc_registerClassPair(enumClass);
+
+    return enumClass;
+}
+
+
++ (NSData *) dataWithClassName: (NSString *) className
+                         names: (NSArray *) names
+                        values: (NSArray *) values
+                  descriptions: (NSArray *) descriptions
+{
+    NSParameterAssert(names.count == values.count && names.count == descriptions.count);
+
+    uint32_t count = (uint32_t)names.count;
+
+    NSMutableArray *utf8Names = [NSMutableArray arrayWithCapacity: count];
+
+    for (NSString *name in names)
+    {
+        [utf8Names addObject: [name dataUsingEncoding: NSUTF8StringEncoding]];
+    }
+
+    NSMutableArray *namesIndex  = [NSMutableArray arrayWithCapacity: count];
+    NSMutableArray *valuesIndex = [NSMutableArray arrayWithCapacity: count];
+
+    for (uint32_t ordinal = 0; ordinal < count; ++ordinal)
+    {
+        [namesIndex  addObject: @(ordinal)];
+        [valuesIndex addObject: @(ordinal)];
+    }
+
+    [namesIndex sortUsingComparator: ^NSComparisonResult(NSNumber *ordinal1, NSNumber *ordinal2) {
+        NSData *name1 = utf8Names[ordinal1.unsignedIntegerValue];
+        NSData *name2 = utf8Names[ordinal2.unsignedIntegerValue];
+        return HRRuntimeEnumCompareNames(name1.bytes, name1.length, name2.bytes, name2.length);
+    }];
+
+    [valuesIndex sortUsingComparator: ^NSComparisonResult(NSNumber *ordinal1, NSNumber *ordinal2) {
+        return [values[ordinal1.unsignedIntegerValue] compare: values[ordinal2.unsignedIntegerValue]];
+    }];
+
+    // The same checks as in HRRuntimeEnumValidate, so that files which would be rejected are not written at all
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        NSData *name = utf8Names[[namesIndex[i] unsignedIntegerValue]];
+
+        if (name.length == 0)
+        {
+            return nil;
+        }
+
+        if (i > 0)
+        {
+            NSData   *previousName  = utf8Names[[namesIndex[i-1] unsignedIntegerValue]];
+            NSNumber *previousValue = values[[valuesIndex[i-1] unsignedIntegerValue]];
+            NSNumber *value         = values[[valuesIndex[i] unsignedIntegerValue]];
+
+            if (HRRuntimeEnumCompareNames(previousName.bytes, previousName.length,
+                                          name.bytes, name.length) == NSOrderedSame ||
+                previousValue.longLongValue == value.longLongValue)
+            {
+                return nil;
+            }
+        }
+    }
+
+    HRRuntimeEnumHeader header = { .version = HR_RUNTIME_ENUM_VERSION, .count = count };
+    memcpy(header.magic, HR_RUNTIME_ENUM_MAGIC, sizeof(header.magic));
+
+    header.entriesOffset     = sizeof(HRRuntimeEnumHeader);
+    header.namesIndexOffset  = header.entriesOffset + count * sizeof(HRRuntimeEnumEntry);
+    header.valuesIndexOffset = header.namesIndexOffset + count * sizeof(uint32_t);
+
+    NSMutableData *strings = [NSMutableData data];
+    uint32_t stringsOffset = header.valuesIndexOffset + count * sizeof(uint32_t);
+
+    uint32_t (^appendString)(NSData *, uint32_t *) = ^uint32_t(NSData *string, uint32_t *length) {
+        uint32_t offset = stringsOffset + (uint32_t)strings.length;
+        *length = (uint32_t)string.length;
+        [strings appendData: string];
+        [strings appendBytes: "" length: 1];
+        return offset;
+    };
+
+    header.classNameOffset = appendString([className dataUsingEncoding: NSUTF8StringEncoding], &header.classNameLength);
+
+    NSMutableData *data = [NSMutableData dataWithBytes: &header length: sizeof(header)];
+
+    for (uint32_t ordinal = 0; ordinal < count; ++ordinal)
+    {
+        HRRuntimeEnumEntry entry = { .value = [values[ordinal] longLongValue] };
+
+        entry.nameOffset        = appendString(utf8Names[ordinal], &entry.nameLength);
+        entry.descriptionOffset = appendString([descriptions[ordinal] dataUsingEncoding: NSUTF8StringEncoding],
+                                               &entry.descriptionLength);
+
+        [data appendBytes: &entry length: sizeof(entry)];
+    }
+
+    for (NSNumber *ordinal in namesIndex)
+    {
+        uint32_t value = ordinal.unsignedIntValue;
+        [data appendBytes: &value length: sizeof(value)];
+    }
+
+    for (NSNumber *ordinal in valuesIndex)
+    {
+        uint32_t value = ordinal.unsignedIntValue;
+        [data appendBytes: &value length: sizeof(value)];
+    }
+
+    [data appendData: strings];
+
+    return data;
+}
+
+@end
+
+
+
+
+
+#pragma mark -
+#pragma mark Zero-copy lookups
+
+NSUInteger HRRuntimeEnumCount(Class enumClass)
+{
+    return HRRuntimeEnumGetMetadata(enumClass)->header->count;
+}
+
+
+BOOL HRRuntimeEnumValueForName(Class enumClass, const char *name, size_t length, NSInteger *value)
+{
+    const HRRuntimeEnumMetadata *metadata = HRRuntimeEnumGetMetadata(enumClass);
+    NSUInteger ordinal = HRRuntimeEnumOrdinalForName(metadata, name, length);
+
+    if (ordinal == NSNotFound)
+    {
+        return NO;
+    }
+
+    if (value != NULL)
+    {
+        *value = (NSInteger)metadata->entries[ordinal].value;
+    }
+
+    return YES;
+}
+
+
+HRSmartEnumString HRRuntimeEnumNameForValue(Class enumClass, NSInteger value)
+{
+    const HRRuntimeEnumMetadata *metadata = HRRuntimeEnumGetMetadata(enumClass);
+    NSUInteger ordinal = HRRuntimeEnumOrdinalForValue(metadata, value);
+
+    if (ordinal == NSNotFound)
+    {
+        return (HRSmartEnumString){ NULL, 0 };
+    }
+
+    const HRRuntimeEnumEntry *entry = &metadata->entries[ordinal];
+    return (HRSmartEnumString){ (const char *)metadata->bytes + entry->nameOffset, entry->nameLength };
+}
+
+
+HRSmartEnumString HRRuntimeEnumDescriptionForValue(Class enumClass, NSInteger value)
+{
+    const HRRuntimeEnumMetadata *metadata = HRRuntimeEnumGetMetadata(enumClass);
+    NSUInteger ordinal = HRRuntimeEnumOrdinalForValue(metadata, value);
+
+    if (ordinal == NSNotFound)
+    {
+        return (HRSmartEnumString){ NULL, 0 };
+    }
+
+    const HRRuntimeEnumEntry *entry = &metadata->entries[ordinal];
+    return (HRSmartEnumString){ (const char *)metadata->bytes + entry->descriptionOffset, entry->descriptionLength };
+}
@@ -13,6 +13,335 @@
 #import "metamacro_extra_foreach_cxt.h"
 
 
+#pragma mark -
+#pragma mark Types
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// A NUL-terminated UTF-8 string with precomputed length (not including the terminating NUL).
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    const char *bytes;
+    size_t      length;
+} HRSmartEnumString;
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Pre-encoded strings of a single enum constant; see MyEnum_strings in the HR_ENUM description.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    HRSmartEnumString name;             // Value1
+    HRSmartEnumString jsonName;         // "Value1"
+    HRSmartEnumString description;      // String description of the Value1
+    HRSmartEnumString jsonDescription;  // "String description of the Value1", quoted and escaped as a JSON string
+} HRSmartEnumStrings;
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Column decoding
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Decodes a column of enum constant names from a delimited text buffer into an array of the enum values.
+//
+// The buffer consists of rows separated by '\n' ("\r\n" line endings are handled as well), fields of every row are
+// separated by the given separator character; column is a zero-based index of the field containing the enum constant
+// names without the enum prefix. Fields enclosed in double quotes are unquoted, but no escape sequences are handled.
+//
+// Returns the number of rows in the buffer. If it is greater than capacity, nothing is decoded, so the function
+// can be called with zero capacity to find out the size of the output arrays. Otherwise values[row] receives the
+// enum constant for every valid row, and if invalidRows is not NULL, it receives a bitmap of (rows + 63) / 64 words
+// with bit (row % 64) of word (row / 64) set for the rows which do not have such a field or have an unknown name
+// in it; values of such rows are left untouched.
+//
+// The buffer is split into chunks at row boundaries which are decoded in parallel on the global dispatch queue.
+// Names are matched against a small hash table built on the stack, so decoding does not allocate memory apart
+// from a couple of small arrays per call.
+//
+// names and values are arrays of count elements indexed by ordinal, MyEnum_decode_column passes the ones of the enum.
+// count should be less than 512 which is far more than HR_ENUM allows; for larger counts, or if the chunk arrays
+// cannot be allocated, nothing is decoded and 0 is returned.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+extern size_t HRSmartEnumDecodeColumn(const HRSmartEnumString *names, const NSInteger *values, NSUInteger count,
+                                      const char *bytes, size_t length, char separator, NSUInteger column,
+                                      NSInteger *output, size_t capacity, uint64_t *invalidRows);
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Random sampling
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// State of a xoshiro256** pseudorandom number generator.
+//
+// The generator is not thread-safe; every thread is expected to have its own state, seeded with a distinct seed
+// (for example, a thread index) by HRSmartEnumRandomSeed. Not suitable for cryptographic purposes.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    uint64_t state[4];
+} HRSmartEnumRandom;
+
+extern void HRSmartEnumRandomSeed(HRSmartEnumRandom *random, uint64_t seed);
+
+static inline uint64_t HRSmartEnumRandomNext(HRSmartEnumRandom *random)
+{
+    uint64_t *s      = random->state;
+    uint64_t  result = s[1] * 5;
+    uint64_t  t      = s[1] << 17;
+
+    result = ((result << 7) | (result >> 57)) * 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3]  = (s[3] << 45) | (s[3] >> 19);
+
+    return result;
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// A slot of the alias table used by MyEnum_sampler_t (see HR_ENUM).
+//
+// A sample picks a slot uniformly and then returns the slot itself if the next 32 random bits are below threshold,
+// or alias otherwise. Slots which should always return themselves have alias equal to their own index.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    uint32_t threshold;
+    uint32_t alias;
+} HRSmartEnumAliasSlot;
+
+// Builds the alias table of count slots for the given non-negative weights (Vose's method); constants with zero
+// weight are never sampled. count is expected to be small (at most the number of enum constants) since the temporary
+// arrays are allocated on the stack. Returns NO and leaves slots unchanged if any of the weights is negative or NaN,
+// or if their sum is zero or infinite.
+extern BOOL HRSmartEnumBuildAliasTable(const double *weights, NSUInteger count, HRSmartEnumAliasSlot *slots);
+
+// Returns a random index in [0, count) distributed according to the alias table.
+static inline NSUInteger HRSmartEnumSampleAliasTable(const HRSmartEnumAliasSlot *slots, NSUInteger count,
+                                                     HRSmartEnumRandom *random)
+{
+    uint64_t   bits = HRSmartEnumRandomNext(random);
+    NSUInteger slot = (NSUInteger)(((bits >> 32) * count) >> 32);
+
+    return ((uint32_t)bits < slots[slot].threshold) ? slot : slots[slot].alias;
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Schema fingerprints
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns a 64-bit FNV-1a hash of the (name, value) list of an enum, used by MyEnum_fingerprint (see HR_ENUM).
+//
+// Every name is hashed followed by a NUL byte and the value as 8 little-endian bytes, in the order of ordinals, so
+// the fingerprint is the same on all platforms and changes whenever a constant is added, removed, renamed, reordered
+// or gets a different value.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline uint64_t HRSmartEnumFingerprint(const HRSmartEnumString *names, const NSInteger *values, NSUInteger count)
+{
+    uint64_t hash = 14695981039346656037ull;
+
+    for (NSUInteger ordinal = 0; ordinal < count; ++ordinal)
+    {
+        for (size_t i = 0; i <= names[ordinal].length; ++i)
+        {
+            hash = (hash ^ (uint8_t)names[ordinal].bytes[i]) * 1099511628211ull;
+        }
+
+        for (NSUInteger i = 0; i < 8; ++i)
+        {
+            hash = (hash ^ (uint8_t)((uint64_t)(int64_t)values[ordinal] >> (8 * i))) * 1099511628211ull;
+        }
+    }
+
+    return hash;
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Maps values of an enum stored with a different (name, value) list to the current values by constant names; see
+// MyEnum_remap_create in the HR_ENUM description.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct HRSmartEnumRemap HRSmartEnumRemap;
+
+// Creates the remap table from the stored names and values to the current ones. All arrays are indexed by ordinal.
+// If several stored constants which still exist share the same value, it is mapped by the first of them. Returns
+// NULL if count is not less than 512 or the table cannot be allocated.
+extern HRSmartEnumRemap *HRSmartEnumRemapCreate(const HRSmartEnumString *storedNames, const NSInteger *storedValues,
+                                                NSUInteger storedCount, const HRSmartEnumString *names,
+                                                const NSInteger *values, NSUInteger count);
+
+// Finds the current value for the stored one. Returns NO if the stored value is unknown or the constant with that
+// name does not exist anymore.
+extern BOOL HRSmartEnumRemapValue(const HRSmartEnumRemap *remap, NSInteger storedValue, NSInteger *value);
+
+extern void HRSmartEnumRemapFree(HRSmartEnumRemap *remap);
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Memoization
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Installs the object into an empty memo slot of MyEnum_memo_t (see HR_ENUM) with a single compare-and-swap.
+//
+// Returns the object which ends up in the slot: the given one (retained by the slot), or the one installed by
+// another thread in the meantime, in which case the given object is discarded.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+extern void *HRSmartEnumMemoInstall(void **slot, id object);
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Localized descriptions
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Descriptions of all of the enum constants localized for a single localization, indexed by ordinal.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct HRSmartEnumLocalizedDescriptions
+{
+    CFStringRef                                    localization;
+    const struct HRSmartEnumLocalizedDescriptions *next;
+    CFStringRef                                    descriptions[];
+} HRSmartEnumLocalizedDescriptions;
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Localized descriptions of an enum class (see MyEnum_localized_description in the HR_ENUM description): the table
+// of the current localization and the list of all of the tables loaded so far linked through their next pointers.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    const HRSmartEnumLocalizedDescriptions *current;
+    const HRSmartEnumLocalizedDescriptions *loaded;
+} HRSmartEnumLocalization;
+
+// Makes the table of the preferred localization of the main bundle current, loading it from the .lproj directory
+// of that localization if it has not been loaded yet. descriptions are the non-localized descriptions indexed by
+// ordinal. Tables are never freed, but there is at most one of them per localization, so reloading does not leak.
+// The current table is left unchanged if a new one cannot be allocated.
+extern void HRSmartEnumLoadLocalizedDescriptions(HRSmartEnumLocalization *localization, NSArray *descriptions);
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Instrumentation
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Instrumentation of the allocating accessors of the enum classes is compiled into SYNTHESIZE_HR_ENUM when
+// HR_ENUM_INSTRUMENTATION is defined to 1 before importing this header (e.g. in the preprocessor macros of the build
+// settings, so that all of the files see the same value). It is disabled by default, in which case the accessors
+// are generated exactly as if they were never instrumented.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef HR_ENUM_INSTRUMENTATION
+#define HR_ENUM_INSTRUMENTATION 0
+#endif
+
+#if HR_ENUM_INSTRUMENTATION
+#import <mach/mach_time.h>
+#endif
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Instrumented accessors of the enum class, used as indices in HRSmartEnumInstrumentationSnapshot.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef NS_ENUM(NSUInteger, HRSmartEnumAccessor)
+{
+    HRSmartEnumAccessorAsDictionary,         // + (NSDictionary *) asDictionary
+    HRSmartEnumAccessorAllKeys,              // + (NSArray *) allKeys
+    HRSmartEnumAccessorAllValues,            // + (NSArray *) allValues
+    HRSmartEnumAccessorDescriptionForValue,  // + (NSDictionary *) descriptionForValue
+
+    HRSmartEnumAccessorCount
+};
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Counters of a single accessor.
+//
+// Objects are the ones created by the accessor itself: the returned collection and the boxed enum values in it
+// (objects created by the nested asDictionary call of allKeys and allValues are counted for asDictionary).
+// Time includes the nested calls, i.e. time of allKeys includes the time of asDictionary it calls.
+//
+// Instance method versions of the accessors forward to the class methods and are counted as their calls.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    uint64_t calls;
+    uint64_t objects;
+    uint64_t nanoseconds;
+} HRSmartEnumAccessorCounters;
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Counters of all of the instrumented accessors of an enum class returned by + instrumentationSnapshot.
+//
+// Counters are updated with relaxed atomic increments, so a snapshot taken while the accessors are being called
+// on other threads may have the counters of a call which is still in progress partially updated.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+typedef struct
+{
+    HRSmartEnumAccessorCounters accessors[HRSmartEnumAccessorCount];
+} HRSmartEnumInstrumentationSnapshot;
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
 #pragma mark -
 #pragma mark Macros to use in code
 
@@ -72,12 +401,114 @@
 //     values into the string descriptions which were provided in the HR_ENUM declaration.
 //      In our example calling [MyEnum descriptionForValue][@(MyEnumValue1)] would yield the string
 //        @"String description of the Value1"
+//  * Both + and - versions of the valueForKey: method are overridden to look the enum constant names up in a cached
+//     name table, so [MyEnum valueForKey:@"Value1"] returns a pre-boxed @(MyEnumValue1) without going through
+//     the generic KVC accessor search. Unknown keys are forwarded to the NSObject implementation.
+//  * + (instancetype) enumWithValue: (NSInteger) value which returns an instance of MyEnum representing the given
+//     enum constant, or nil if the value does not correspond to any of the enum constants. There is exactly one such
+//     instance per enum constant which is created when the class is initialized and is never deallocated, so this
+//     method never allocates and the instances can be compared by pointer,
+//  * - (NSInteger) enumValue which returns the enum constant the instance represents.
+//  Since the instances returned by +enumWithValue: are unique per enum constant, MyEnum instances keep the identity
+//  based isEqual: and hash of NSObject and conform to NSCopying (returning self), so they can be used in collections
+//  and as dictionary keys in place of NSNumbers. Instances created with +new or +alloc do not represent any enum
+//  constant: they are only equal to themselves, and their enumValue is 0 whether or not 0 is one of the constants.
+//
+// Enum constants are also numbered in the order of declaration starting from 0 (these numbers are called ordinals
+// below), and the following plain C helpers are declared for the enum:
+//  * MyEnum_count - number of the enum constants (4 in our example),
+//  * NSUInteger MyEnum_ordinal(MyEnum_t value) - returns ordinal of the given enum constant (MyEnum_ordinal(MyEnumValue5)
+//     returns 2) or NSNotFound if the value does not correspond to any of the enum constants,
+//  * MyEnum_t MyEnum_value(NSUInteger ordinal) - returns the enum constant with the given ordinal; the ordinal is not
+//     checked and should be less than MyEnum_count.
+// Enum constants may share the same value, in which case MyEnum_ordinal returns ordinal of the first of them.
+//
+// Plain C arrays of the enum values can be sorted and grouped in linear time using the following functions:
+//  * void MyEnum_histogram(const MyEnum_t *values, size_t length, size_t *counts) - counts the number of occurrences
+//     of every enum constant; counts should have MyEnum_count+1 elements, counts[ordinal] receives the number of
+//     occurrences of the constant with that ordinal, and the last one receives the number of values which do not
+//     correspond to any of the enum constants,
+//  * void MyEnum_counting_sort(MyEnum_t *values, size_t length) - sorts the values in place by their ordinals (i.e.
+//     in the order of declaration of the enum constants); values which do not correspond to any of the enum constants
+//     are moved to the end of the array keeping their relative order,
+//  * void MyEnum_partition(const MyEnum_t *values, size_t length, size_t *indices, size_t *offsets) - groups indices
+//     of the values by their ordinals; indices should have length elements and offsets should have MyEnum_count+2
+//     elements. Indices of the values with ordinal N are stored in indices[offsets[N]] ... indices[offsets[N+1]-1]
+//     in ascending order, the last group contains indices of the values which do not correspond to any of the enum
+//     constants.
+// Each of these functions has a _concurrent version (MyEnum_histogram_concurrent etc.) with the same parameters which
+// splits the array into chunks processed on the global dispatch queue; it is worth using for arrays with millions
+// of elements. MyEnum_counting_sort_concurrent also allocates a temporary buffer of the array size; if the temporary
+// memory cannot be allocated, the _concurrent versions fall back to the sequential ones.
+//
+// For the output code which needs the enum constant names and descriptions as bytes, there is also
+//  * const HRSmartEnumStrings *MyEnum_strings(MyEnum_t value) - returns the name and description of the enum constant
+//     encoded as UTF-8 and as JSON string literals (quoted and escaped) along with their lengths, or NULL if the value
+//     does not correspond to any of the enum constants (or the strings could not be allocated). All of these strings
+//     are stored in a single contiguous immutable block of memory which is built once when the enum class is
+//     initialized, so the output code can memcpy/writev them as is without any transcoding or allocation.
+//
+// Columns of enum constant names in large delimited text buffers (CSV files, logs etc.) can be decoded with
+//  * size_t MyEnum_decode_column(const char *bytes, size_t length, char separator, NSUInteger column,
+//                                MyEnum_t *values, size_t capacity, uint64_t *invalidRows)
+//     which is a shortcut for HRSmartEnumDecodeColumn with the names and values of the enum; see its description below.
+//
+// Values of the enum persisted by one version of an application can be loaded by another one where the enum
+// declaration may have changed. The following helpers allow to validate them once per file rather than once per value:
+//  * const HRSmartEnumString *MyEnum_name(NSUInteger ordinal) - returns the name of the enum constant with the given
+//     ordinal from a static table (no class initialization required), to be persisted along with MyEnum_value,
+//  * uint64_t MyEnum_fingerprint(void) - returns a hash of the (name, value) list of the enum (see
+//     HRSmartEnumFingerprint). If the fingerprint stored in the file header is equal to it, stored values can be used
+//     as is without any validation,
+//  * HRSmartEnumRemap *MyEnum_remap_create(const HRSmartEnumString *storedNames, const NSInteger *storedValues,
+//                                          NSUInteger storedCount) - otherwise creates a table which maps the stored
+//     values to the current ones by constant names (or returns NULL if it cannot be allocated),
+//  * BOOL MyEnum_remap(const HRSmartEnumRemap *remap, NSInteger storedValue, MyEnum_t *value) - maps a single value,
+//     returning NO if the constant is unknown or was removed; the table is freed with HRSmartEnumRemapFree.
+//
+// Random enum constants with per-constant weights can be sampled in O(1) using an alias table:
+//  * MyEnum_sampler_t - the alias table, it is immutable once built and can be shared between threads,
+//  * BOOL MyEnum_sampler_init(MyEnum_sampler_t *sampler, const double *weights) - builds the table from the array
+//     of MyEnum_count weights indexed by ordinal (for example, declared with HR_ENUM_ATTRIBUTE); returns NO if
+//     the weights are invalid (negative, NaN or all zero), in which case the sampler should not be used,
+//  * MyEnum_t MyEnum_sample(const MyEnum_sampler_t *sampler, HRSmartEnumRandom *random) - returns a random constant,
+//  * void MyEnum_sample_batch(const MyEnum_sampler_t *sampler, HRSmartEnumRandom *random,
+//                             MyEnum_t *values, size_t length) - fills the buffer with random constants.
+// HRSmartEnumRandom is a random number generator state which every thread should have its own copy of, so sampling
+// from multiple threads does not contend on anything.
+//
+// Expensive objects derived from the enum constants (formatted labels, regular expressions etc.) can be cached in
+//  * MyEnum_memo_t - a table of slots indexed by ordinal which should be zero-initialized, e.g. a static variable,
+//  * id MyEnum_memo(MyEnum_memo_t *memo, MyEnum_t value, id (^compute)(MyEnum_t value)) - returns the object cached
+//     for the given enum constant, calling compute to create it on the first access (nil for unknown values).
+// Reading a filled slot is a single acquire load without any locks. Empty slots are filled with a compare-and-swap,
+// so if several threads race for the same slot, compute may be called more than once, but exactly one of the
+// results is installed and returned to all of them. Cached objects are never released, and nil results are not
+// cached.
+//
+// Localized versions of the descriptions are available through
+//  * NSString *MyEnum_localized_description(MyEnum_t value) - returns the description localized with the main bundle
+//     for the preferred localization, or nil for unknown values (or if the descriptions could not be allocated).
+// All of the descriptions are localized once when the enum class is initialized and stored in an array indexed by
+// ordinal, so the lookup does not search any bundles or string tables. On NSCurrentLocaleDidChangeNotification,
+// or when + (void) reloadLocalizedDescriptions is sent to the enum class, the preferred localization is resolved
+// again from [NSLocale preferredLanguages]; if it has changed, the descriptions are loaded from the .lproj directory
+// of the new localization (unlike NSLocalizedString which keeps using the localization chosen at launch) and the
+// array is atomically replaced. Arrays are kept for every localization which has been used, so switching back
+// reuses them.
+//
+// When HR_ENUM_INSTRUMENTATION is defined to 1, the enum class also has
+//  * + (HRSmartEnumInstrumentationSnapshot) instrumentationSnapshot - returns the number of calls, objects
+//     allocated and time spent in +asDictionary, +allKeys, +allValues and +descriptionForValue of the enum class
+//     since it was initialized; see HRSmartEnumAccessorCounters for the details.
 //
 //
 // Please note that current limitations of the metamacro_foreach_cxt macros from extobjc library
 // allow only 30 different values to be handled by HR_ENUM macro.
 // (We've expanded extobjc's set of metamacros to support up to 100 arguments, but all our arguments come in
 //  groups of three, so the actual limit is equal to 33; see metamacro_extra_foreach_cxt.h for more information. )
+// Projects which only have smaller enums can lower this limit by defining HR_ENUM_MAX_CONSTANTS before importing
+// this header, which makes HR_ENUM declarations faster to preprocess; see metamacro_extra_foreach_cxt.h.
 //
 // Also note that MyEnum class in the example above is only declared by using HR_ENUM macro and should be
 // defined in one of the .m files in the application. This can be done using SYNTHESIZE_HR_ENUM macro which
@@ -85,11 +516,15 @@
 //
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #define HR_ENUM(Name, ...)                                              \
-interface Name : NSObject                                               \
+interface Name : NSObject <NSCopying>                                   \
 - (NSArray *) allValues;                                                \
 - (NSArray *) allKeys;                                                  \
 + (NSArray *) allValues;                                                \
 + (NSArray *) allKeys;                                                  \
++ (instancetype) enumWithValue: (NSInteger) value;                      \
++ (void) reloadLocalizedDescriptions;                                   \
+- (NSInteger) enumValue;                                                \
+HR_ENUM_INSTRUMENTATION_INTERFACE                                       \
 @end                                                                    \
                                                                         \
 typedef NS_ENUM(NSInteger, metamacro_concat(Name, _t))                  \
@@ -97,6 +532,13 @@ typedef NS_ENUM(NSInteger, metamacro_concat(Name, _t))                  \
     metamacro_foreach_cxt(HR_ENUM_ENUM_ELEMENT, , Name, __VA_ARGS__)    \
 };                                                                      \
                                                                         \
+HR_ENUM_ORDINALS(Name, __VA_ARGS__)                                     \
+HR_ENUM_SORTING(Name)                                                   \
+HR_ENUM_DECODING(Name, __VA_ARGS__)                                     \
+HR_ENUM_SCHEMA(Name)                                                    \
+HR_ENUM_SAMPLING(Name)                                                  \
+HR_ENUM_MEMO(Name)                                                      \
+                                                                        \
 metamacro_foreach_cxt(HR_ENUM_PROPERTY,      , Name, __VA_ARGS__)       \
 metamacro_foreach_cxt(HR_ENUM_STATIC_METHOD, , Name, __VA_ARGS__)       \
                                                                         \
@@ -104,6 +546,9 @@ HR_ENUM_CONSTRUCT_PROPERTIES(Name, __VA_ARGS__)                         \
 HR_ENUM_CONSTRUCT_CLASSMETHODS(Name, __VA_ARGS__)                       \
 HR_ENUM_AS_DICTIONARY(Name, __VA_ARGS__)                                \
 HR_ENUM_NAME_FOR_VALUE(Name, __VA_ARGS__)                               \
+HR_ENUM_VALUE_FOR_KEY(Name, __VA_ARGS__)                                \
+HR_ENUM_STRINGS(Name, __VA_ARGS__)                                      \
+HR_ENUM_LOCALIZED_DESCRIPTIONS(Name, __VA_ARGS__)                       \
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -115,39 +560,95 @@ HR_ENUM_NAME_FOR_VALUE(Name, __VA_ARGS__)                               \
 //
 // Provides runtime implementations for methods declared when using HR_ENUM macro.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#define SYNTHESIZE_HR_ENUM(CLASS)                      \
-implementation CLASS                                   \
-                                                       \
-+ (void) initialize                                    \
-{                                                      \
-    if (self == [CLASS class])                         \
-    {                                                  \
-        hr_enum_construct_ ## CLASS ##_classmethods(); \
-        hr_enum_construct_ ## CLASS ##_properties();   \
-        hr_enum_construct_ ## CLASS ##_asDictionary(); \
-        hr_enum_construct_ ## CLASS ##_nameForValue(); \
-    }                                                  \
-}                                                      \
-                                                       \
-- (NSArray *) allValues                                \
-{                                                      \
-    return [[self class] allValues];                   \
-}                                                      \
-                                                       \
-- (NSArray *) allKeys                                  \
-{                                                      \
-    return [[self class] allKeys];                     \
-}                                                      \
-                                                       \
-+ (NSArray *) allValues                                \
-{                                                      \
-    return [[self asDictionary] allValues];            \
-}                                                      \
-                                                       \
-+ (NSArray *) allKeys                                  \
-{                                                      \
-        return [[self asDictionary] allKeys];          \
-}                                                      \
+#define SYNTHESIZE_HR_ENUM(CLASS)                              \
+implementation CLASS                                           \
+{                                                              \
+    NSInteger _enumValue;                                      \
+}                                                              \
+                                                               \
+const HRSmartEnumStrings *hr_enum_ ## CLASS ##_strings = NULL; \
+HRSmartEnumLocalization hr_enum_ ## CLASS ##_localization;     \
+                                                               \
+static CLASS *hr_enum_ ## CLASS ##_instances[CLASS ## _count]; \
+                                                               \
+static void hr_enum_construct_ ## CLASS ##_instances(void)     \
+{                                                              \
+    for (NSUInteger i = 0; i < CLASS ## _count; ++i)           \
+    {                                                          \
+        CLASS *instance = [CLASS new];                         \
+        instance->_enumValue = CLASS ## _value(i);             \
+        hr_enum_ ## CLASS ##_instances[i] = instance;          \
+    }                                                          \
+}                                                              \
+                                                               \
+HR_ENUM_INSTRUMENTATION_IMPLEMENTATION(CLASS)                  \
+                                                               \
++ (void) initialize                                            \
+{                                                              \
+    if (self == [CLASS class])                                 \
+    {                                                          \
+        hr_enum_construct_ ## CLASS ##_classmethods();         \
+        hr_enum_construct_ ## CLASS ##_properties();           \
+        hr_enum_construct_ ## CLASS ##_asDictionary();         \
+        hr_enum_construct_ ## CLASS ##_nameForValue();         \
+        hr_enum_construct_ ## CLASS ##_valueForKey();          \
+        hr_enum_construct_ ## CLASS ##_strings();              \
+        hr_enum_construct_ ## CLASS ##_instances();            \
+        hr_enum_construct_ ## CLASS ##_localization();         \
+        HR_ENUM_INSTRUMENTATION_CONSTRUCT(CLASS)               \
+    }                                                          \
+}                                                              \
+                                                               \
++ (void) reloadLocalizedDescriptions                           \
+{                                                              \
+    hr_enum_ ## CLASS ##_load_localization();                  \
+}                                                              \
+                                                               \
++ (instancetype) enumWithValue: (NSInteger) value              \
+{                                                              \
+    NSUInteger ordinal = CLASS ## _ordinal(value);             \
+                                                               \
+    return (ordinal < CLASS ## _count) ?                       \
+        hr_enum_ ## CLASS ##_instances[ordinal] : nil;         \
+}                                                              \
+                                                               \
+- (NSInteger) enumValue                                        \
+{                                                              \
+    return _enumValue;                                         \
+}                                                              \
+                                                               \
+- (id) copyWithZone: (NSZone *) zone                           \
+{                                                              \
+    return self;                                               \
+}                                                              \
+                                                               \
+- (NSArray *) allValues                                        \
+{                                                              \
+    return [[self class] allValues];                           \
+}                                                              \
+                                                               \
+- (NSArray *) allKeys                                          \
+{                                                              \
+    return [[self class] allKeys];                             \
+}                                                              \
+                                                               \
++ (NSArray *) allValues                                        \
+{                                                              \
+    HR_ENUM_INSTRUMENTATION_BEGIN()                            \
+    NSArray *allValues = [[self asDictionary] allValues];      \
+    HR_ENUM_INSTRUMENTATION_END(CLASS, AllValues, 1)           \
+                                                               \
+    return allValues;                                          \
+}                                                              \
+                                                               \
++ (NSArray *) allKeys                                          \
+{                                                              \
+    HR_ENUM_INSTRUMENTATION_BEGIN()                            \
+    NSArray *allKeys = [[self asDictionary] allKeys];          \
+    HR_ENUM_INSTRUMENTATION_END(CLASS, AllKeys, 1)             \
+                                                               \
+    return allKeys;                                            \
+}                                                              \
 @end
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -155,35 +656,100 @@ implementation CLASS                                   \
 
 
 
-#pragma mark -
-#pragma mark Implementation details
-
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Adds a property returning the proper enum element value.
+// The macro which is used to declare allowed transitions between the enum constants when the enum is used as a set
+// of states of a state machine.
 //
-// Skips every odd parameter since varargs passed to HR_ENUM contain NSString descriptions of enum constants which
-// should not go into the properties list.
+// Should be placed right after the HR_ENUM declaration with the following syntax:
+//
+//      @HR_ENUM(Door,
+//               Open,,,
+//               Closed,,,
+//               Locked,,);
+//
+//      HR_ENUM_TRANSITIONS(Door,           // First parameter of the macro is the enum name
+//                          Open,   (Closed),
+//                          Closed, (Open, Locked),
+//                          Locked, (Closed));
+//
+// The rest of the parameters come in pairs: an enum constant name without the enum prefix and a parenthesized list
+// of the constant names the state machine is allowed to move to from that constant. Constants which are not listed
+// as a source of transitions are final states. Misspelled constant names are reported at compile time.
+//
+// Allowed transitions are stored in a static bit matrix indexed by ordinals of the enum constants which is built at
+// compile time, and the following plain C helpers are declared:
+//  * uint64_t Door_transitions(Door_t from) - returns a mask of the states reachable from the given one, with bit
+//     (1 << Door_ordinal(to)) set for every allowed transition (for example, to enumerate them in a single pass),
+//  * BOOL Door_can_transition(Door_t from, Door_t to) - checks whether the transition is allowed,
+//  * Door_atomic_t - a lock-free holder of the current state which can be shared between threads, and functions
+//     to work with it:
+//     * BOOL Door_atomic_init(Door_atomic_t *state, Door_t value) - sets the initial state (not an atomic operation);
+//        returns NO and leaves the state unchanged if the value does not correspond to any of the enum constants,
+//     * Door_t Door_atomic_load(const Door_atomic_t *state) - returns the current state,
+//     * BOOL Door_atomic_transition(Door_atomic_t *state, Door_t from, Door_t to) - validates the transition against
+//        the matrix and performs it with a single compare-and-swap. Returns NO if the transition is not allowed or
+//        the current state is not equal to 'from' (i.e. another thread has changed it in the meantime).
+//
+// Transitions matrix rows are 64-bit masks which is enough for the 33 constants limit of the HR_ENUM macro.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#define HR_ENUM_PROPERTY(Index, CLASS, Name) \
-    metamacro_concat(HR_ENUM_PROPERTY_, metamacro_rem3(Index))(Index, CLASS, Name)
-
-#define HR_ENUM_PROPERTY_2(Index, CLASS, Name)
-#define HR_ENUM_PROPERTY_1(Index, CLASS, Name)
-#define HR_ENUM_PROPERTY_0(Index, CLASS, Name)                                                                  \
-@interface CLASS(DynamicProperty_ ## Name)                                                                      \
-@property (readonly, nonatomic) NSInteger Name;                                                                 \
-@end                                                                                                            \
-                                                                                                                \
-static NSInteger hr_enum_ ## CLASS ##_property ## Name ##_implementation(id SELF, SEL CMD, ...)                 \
-{                                                                                                               \
-    return (NSInteger)objc_msgSend([SELF class], CMD);                                                          \
-}                                                                                                               \
-                                                                                                                \
-__attribute__((unused))                                                                                         \
-static void hr_enum_construct_ ## CLASS ##_property_ ## Name(void)                                              \
-{                                                                                                               \
-    Class theClass  = objc_getClass(# CLASS);                                                                   \
-    class_addMethod(theClass, @selector(Name), (IMP)&hr_enum_ ## CLASS ##_property ## Name ##_implementation, "i@"); \
+#define HR_ENUM_TRANSITIONS(Name, ...)                                                                              \
+__attribute__((unused))                                                                                             \
+static const uint64_t hr_enum_ ## Name ##_transitions[metamacro_concat(Name, _count)] =                             \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_TRANSITIONS_ELEMENT, , Name, __VA_ARGS__)                                         \
+};                                                                                                                  \
+                                                                                                                    \
+typedef struct                                                                                                      \
+{                                                                                                                   \
+    NSUInteger ordinal;                                                                                             \
+} metamacro_concat(Name, _atomic_t);                                                                                \
+                                                                                                                    \
+static inline uint64_t metamacro_concat(Name, _transitions)(metamacro_concat(Name, _t) from)                        \
+{                                                                                                                   \
+    NSUInteger ordinal = metamacro_concat(Name, _ordinal)(from);                                                    \
+    return (ordinal < metamacro_concat(Name, _count)) ? hr_enum_ ## Name ##_transitions[ordinal] : 0;               \
+}                                                                                                                   \
+                                                                                                                    \
+static inline BOOL metamacro_concat(Name, _can_transition)(metamacro_concat(Name, _t) from,                         \
+                                                           metamacro_concat(Name, _t) to)                           \
+{                                                                                                                   \
+    NSUInteger ordinal = metamacro_concat(Name, _ordinal)(to);                                                      \
+    return (ordinal < metamacro_concat(Name, _count)) &&                                                            \
+           (metamacro_concat(Name, _transitions)(from) & (1ull << ordinal)) != 0;                                   \
+}                                                                                                                   \
+                                                                                                                    \
+static inline BOOL metamacro_concat(Name, _atomic_init)(metamacro_concat(Name, _atomic_t) *state,                   \
+                                                        metamacro_concat(Name, _t) value)                           \
+{                                                                                                                   \
+    NSUInteger ordinal = metamacro_concat(Name, _ordinal)(value);                                                   \
+                                                                                                                    \
+    if (ordinal >= metamacro_concat(Name, _count)) return NO;                                                       \
+                                                                                                                    \
+    state->ordinal = ordinal;                                                                                       \
+    return YES;                                                                                                     \
+}                                                                                                                   \
+                                                                                                                    \
+static inline metamacro_concat(Name, _t) metamacro_concat(Name, _atomic_load)                                       \
+    (const metamacro_concat(Name, _atomic_t) *state)                                                                \
+{                                                                                                                   \
+    return metamacro_concat(Name, _value)(__atomic_load_n(&state->ordinal, __ATOMIC_ACQUIRE));                      \
+}                                                                                                                   \
+                                                                                                                    \
+static inline BOOL metamacro_concat(Name, _atomic_transition)(metamacro_concat(Name, _atomic_t) *state,             \
+                                                              metamacro_concat(Name, _t) from,                      \
+                                                              metamacro_concat(Name, _t) to)                        \
+{                                                                                                                   \
+    NSUInteger fromOrdinal = metamacro_concat(Name, _ordinal)(from);                                                \
+    NSUInteger toOrdinal   = metamacro_concat(Name, _ordinal)(to);                                                  \
+                                                                                                                    \
+    if (fromOrdinal >= metamacro_concat(Name, _count) || toOrdinal >= metamacro_concat(Name, _count) ||             \
+        (hr_enum_ ## Name ##_transitions[fromOrdinal] & (1ull << toOrdinal)) == 0)                                  \
+    {                                                                                                               \
+        return NO;                                                                                                  \
+    }                                                                                                               \
+                                                                                                                    \
+    return __atomic_compare_exchange_n(&state->ordinal, &fromOrdinal, toOrdinal,                                    \
+                                       false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);                                  \
 }
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -191,39 +757,82 @@ static void hr_enum_construct_ ## CLASS ##_property_ ## Name(void)
 
 
 
-
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Performs a call to one of the property construction functions.
+// The macro which is used to declare conversion between two enums which share the constant names but differ in values
+// (for example, an enum used in a wire protocol and an enum used internally).
 //
-// This is a helper macro to be used in conjunction with metamacro_foreach_cxt when iterating property
-// names of the enum class.
+// Preprocessor cannot look at the constants of an enum by its name, so the constants of the source enum should be
+// declared as a separate macro named <EnumName>_HR_ENUM_CONSTANTS which is passed to HR_ENUM (the macro may of course
+// span several lines):
 //
-// Skips every odd parameter since varargs passed to HR_ENUM contain NSString descriptions of enum constants which
-// should not go into the properties list.
+//      #define Wire_HR_ENUM_CONSTANTS Ok, 200, @"OK", NotFound, 404, @"Not found"
+//
+//      @HR_ENUM(Wire, Wire_HR_ENUM_CONSTANTS);
+//
+//      @HR_ENUM(Status,
+//               Ok,,,
+//               NotFound,,,
+//               Unknown,,);
+//
+//      HR_ENUM_MAPPING(Wire, Status);
+//
+// Every constant of the source enum is matched with the constant of the same name in the destination enum; if there
+// is no such constant, compilation fails with an 'undeclared identifier hr_enum_Status_ordinal_...' error. Extra
+// constants of the destination enum are allowed.
+//
+// The mapping is stored in static tables indexed by ordinal which are built at compile time, and the following plain
+// C helpers are declared:
+//  * NSUInteger Wire_to_Status_ordinal(NSUInteger ordinal) - maps ordinal of a Wire constant to ordinal of the
+//     corresponding Status constant with a single array load,
+//  * BOOL Wire_to_Status_checked(Wire_t value, Status_t *result) - maps a Wire constant to the corresponding Status
+//     constant and stores it in result; returns NO and leaves result unchanged if value is not one of the Wire
+//     constants (e.g. an unknown value read from the wire).
+// Only Wire_to_Status_ordinal is unchecked, the ordinal should be less than Wire_count.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#define HR_ENUM_CONSTRUCT_PROPERTY_CALL(Index, CLASS, Name) \
-    metamacro_concat(HR_ENUM_CONSTRUCT_PROPERTY_CALL_, metamacro_rem3(Index))(Index, CLASS, Name)
-
-#define HR_ENUM_CONSTRUCT_PROPERTY_CALL_2(Index, CLASS, Name)
-#define HR_ENUM_CONSTRUCT_PROPERTY_CALL_1(Index, CLASS, Name)
-#define HR_ENUM_CONSTRUCT_PROPERTY_CALL_0(Index, CLASS, Name) \
-    hr_enum_construct_ ## CLASS ##_property_ ## Name();
+#define HR_ENUM_MAPPING(From, To) \
+    HR_ENUM_MAPPING_IMPLEMENTATION(From, To, metamacro_concat(From, _HR_ENUM_CONSTANTS))
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
 
 
 
-
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Generates a function to be called from +initialize method of the enum class which adds property getters
-// at runtime.
+// The macro which is used to attach a typed attribute (weight, priority, limit etc.) to the enum constants.
+//
+// Should be placed right after the HR_ENUM declaration with the following syntax:
+//
+//      @HR_ENUM(Job,
+//               Backup,,,
+//               Report,,,
+//               Cleanup,,);
+//
+//      HR_ENUM_ATTRIBUTE(Job, double,  weight,   Backup, 0.5, Report, 2.0, Cleanup, 0.25);
+//      HR_ENUM_ATTRIBUTE(Job, int32_t, priority, Backup, 10,  Report, 5);
+//
+// First three parameters are the enum name, the attribute type and the attribute name, the rest of the parameters
+// come in pairs: an enum constant name without the enum prefix and the attribute value for that constant. Constants
+// which are not listed get a zero value. Values containing commas (such as struct values) should be written as
+// parenthesized compound literals, e.g. ((Range){ 0, 10 }).
+//
+// Every attribute is stored in its own static const array indexed by ordinals of the enum constants, so scanning
+// a single attribute across all constants touches a single contiguous block of memory, and the following plain C
+// helpers are declared:
+//  * const double Job_weight[Job_count] - the array itself, Job_weight[Job_ordinal(value)] is a single load,
+//  * double Job_weight_of(Job_t value) - returns the attribute value for the given enum constant or zero if the value
+//     is not one of the enum constants.
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#define HR_ENUM_CONSTRUCT_PROPERTIES(CLASS, ...)                                \
-__attribute__((unused))                                                         \
-static void hr_enum_construct_ ## CLASS ##_properties(void)                     \
-{                                                                               \
-    metamacro_foreach_cxt(HR_ENUM_CONSTRUCT_PROPERTY_CALL, ,CLASS, __VA_ARGS__) \
+#define HR_ENUM_ATTRIBUTE(Name, Type, Attribute, ...)                                                               \
+__attribute__((unused))                                                                                             \
+static const Type Name ## _ ## Attribute[metamacro_concat(Name, _count)] =                                          \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_ATTRIBUTE_ELEMENT, , Name, __VA_ARGS__)                                           \
+};                                                                                                                  \
+                                                                                                                    \
+static inline Type Name ## _ ## Attribute ## _of(metamacro_concat(Name, _t) value)                                  \
+{                                                                                                                   \
+    NSUInteger ordinal = metamacro_concat(Name, _ordinal)(value);                                                   \
+    return (ordinal < metamacro_concat(Name, _count)) ? Name ## _ ## Attribute[ordinal] : (Type){ 0 };              \
 }
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -231,16 +840,165 @@ static void hr_enum_construct_ ## CLASS ##_properties(void)
 
 
 
-
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Adds a class method returning the proper enum element value.
+// The macro which expands the given macro once for every constant of the enum, so that the code which has to handle
+// every enum constant (serializers, validators, lookup tables etc.) could be generated from the enum declaration
+// rather than written by hand.
 //
-// Skips every odd parameter since varargs passed to HR_ENUM contain NSString descriptions of enum constants which
-// should not go into the class methods list.
-//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-#define HR_ENUM_STATIC_METHOD(Index, CLASS, Name) \
-    metamacro_concat(HR_ENUM_STATIC_METHOD_, metamacro_rem3(Index))(Index, CLASS, Name)
-
+// Just like HR_ENUM_MAPPING, it needs the constants of the enum to be declared as a separate macro named
+// <EnumName>_HR_ENUM_CONSTANTS which is passed to HR_ENUM:
+//
+//      #define Color_HR_ENUM_CONSTANTS Red,, @"Red color", Green,, @"Green color", Blue,,
+//
+//      @HR_ENUM(Color, Color_HR_ENUM_CONSTANTS);
+//
+//      #define COLOR_CASE(Stream, Ordinal, Name, Value, Description) case Value: fputs(#Name, Stream); break;
+//
+//      switch (color) { HR_ENUM_FOREACH(Color, COLOR_CASE, stdout) }
+//
+// The macro is expanded as MACRO(Context, Ordinal, Name, Value, Description) where:
+//  * Context is the third parameter of HR_ENUM_FOREACH passed as is (multiple values can be passed in parentheses),
+//  * Ordinal is an integer literal equal to the ordinal of the enum constant,
+//  * Name is the enum constant name without the enum prefix,
+//  * Value is the enum constant itself (ColorRed etc.),
+//  * Description is the NSString description literal, @"" if the description was omitted.
+//
+// Nothing is inserted between the expansions, so MACRO should include separators such as commas or semicolons
+// itself.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_FOREACH(Name, MACRO, Context) \
+    HR_ENUM_FOREACH_IMPLEMENTATION(Name, MACRO, Context, metamacro_concat(Name, _HR_ENUM_CONSTANTS))
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The macro which is used to declare range queries over the values of the enum, which is useful for enums of
+// thresholds (log levels, size classes etc.).
+//
+// Just like HR_ENUM_MAPPING, it needs the constants of the enum to be declared as a separate macro named
+// <EnumName>_HR_ENUM_CONSTANTS which is passed to HR_ENUM:
+//
+//      #define Level_HR_ENUM_CONSTANTS Debug, 10, , Info, 20, , Warning, 30, , Error, 40,
+//
+//      @HR_ENUM(Level, Level_HR_ENUM_CONSTANTS);
+//
+//      HR_ENUM_RANGES(Level);
+//
+// Positions of the enum constants in the order of values are computed at compile time, and the following tables
+// and plain C helpers are declared:
+//  * const NSInteger Level_sorted_values[Level_count] - values of the enum constants in ascending order,
+//  * const NSUInteger Level_sorted_ordinals[Level_count] - ordinals of the enum constants in the same order,
+//  * NSUInteger Level_floor(NSInteger x) - returns ordinal of the largest enum constant which is not greater than x
+//     (Level_floor(25) is the ordinal of LevelInfo) or NSNotFound if there is no such constant,
+//  * NSUInteger Level_ceil(NSInteger x) - returns ordinal of the smallest enum constant which is not less than x
+//     or NSNotFound if there is no such constant,
+//  * NSRange Level_range(NSInteger low, NSInteger high) - returns the range of positions in the sorted tables of the
+//     enum constants in [low, high], so their ordinals are Level_sorted_ordinals[range.location] ...
+//     Level_sorted_ordinals[NSMaxRange(range)-1].
+//
+// Lookups are binary searches without branches which are fully unrolled since the number of the enum constants is
+// known at compile time. Enum constants which share the same value are kept in the order of declaration in the
+// sorted tables, so Level_floor returns the last and Level_ceil the first of them. Computing the positions takes
+// a number of macro expansions quadratic in the number of the enum constants, which is why this macro is separate
+// from HR_ENUM.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_RANGES(Name) \
+    HR_ENUM_RANGES_IMPLEMENTATION(Name, metamacro_concat(Name, _HR_ENUM_CONSTANTS))
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+#pragma mark -
+#pragma mark Implementation details
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds a property returning the proper enum element value.
+//
+// Skips every odd parameter since varargs passed to HR_ENUM contain NSString descriptions of enum constants which
+// should not go into the properties list.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_PROPERTY(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_PROPERTY_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_PROPERTY_2(Index, CLASS, Name)
+#define HR_ENUM_PROPERTY_1(Index, CLASS, Name)
+#define HR_ENUM_PROPERTY_0(Index, CLASS, Name)                                                                  \
+@interface CLASS(DynamicProperty_ ## Name)                                                                      \
+@property (readonly, nonatomic) NSInteger Name;                                                                 \
+@end                                                                                                            \
+                                                                                                                \
+static NSInteger hr_enum_ ## CLASS ##_property ## Name ##_implementation(id SELF, SEL CMD, ...)                 \
+{                                                                                                               \
+    return (NSInteger)objc_msgSend([SELF class], CMD);                                                          \
+}                                                                                                               \
+                                                                                                                \
+__attribute__((unused))                                                                                         \
+static void hr_enum_construct_ ## CLASS ##_property_ ## Name(void)                                              \
+{                                                                                                               \
+    Class theClass  = objc_getClass(# CLASS);                                                                   \
+    class_addMethod(theClass, @selector(Name), (IMP)&hr_enum_ ## CLASS ##_property ## Name ##_implementation, "i@"); \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Performs a call to one of the property construction functions.
+//
+// This is a helper macro to be used in conjunction with metamacro_foreach_cxt when iterating property
+// names of the enum class.
+//
+// Skips every odd parameter since varargs passed to HR_ENUM contain NSString descriptions of enum constants which
+// should not go into the properties list.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_CONSTRUCT_PROPERTY_CALL(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_CONSTRUCT_PROPERTY_CALL_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_CONSTRUCT_PROPERTY_CALL_2(Index, CLASS, Name)
+#define HR_ENUM_CONSTRUCT_PROPERTY_CALL_1(Index, CLASS, Name)
+#define HR_ENUM_CONSTRUCT_PROPERTY_CALL_0(Index, CLASS, Name) \
+    hr_enum_construct_ ## CLASS ##_property_ ## Name();
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Generates a function to be called from +initialize method of the enum class which adds property getters
+// at runtime.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_CONSTRUCT_PROPERTIES(CLASS, ...)                                \
+__attribute__((unused))                                                         \
+static void hr_enum_construct_ ## CLASS ##_properties(void)                     \
+{                                                                               \
+    metamacro_foreach_cxt(HR_ENUM_CONSTRUCT_PROPERTY_CALL, ,CLASS, __VA_ARGS__) \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds a class method returning the proper enum element value.
+//
+// Skips every odd parameter since varargs passed to HR_ENUM contain NSString descriptions of enum constants which
+// should not go into the class methods list.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_STATIC_METHOD(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_STATIC_METHOD_, metamacro_rem3(Index))(Index, CLASS, Name)
+
 #define HR_ENUM_STATIC_METHOD_2(Index, CLASS, Name)
 #define HR_ENUM_STATIC_METHOD_1(Index, CLASS, Name)
 #define HR_ENUM_STATIC_METHOD_0(Index, CLASS, Name)                                                                 \
@@ -451,3 +1209,1158 @@ static void hr_enum_construct_ ## CLASS ##_nameForValue(void)
 };
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Overrides -valueForKey: and +valueForKey: of the given enum class
+//
+// Enum constant names are looked up in a name table which is built once from the asDictionary representation, so
+// the returned NSNumbers are boxed only once as well. Keys which are not enum constant names are passed to the
+// superclass implementation of valueForKey: which performs the usual KVC accessor search.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_VALUE_FOR_KEY(CLASS, ...)                                                                                           \
+static NSDictionary *hr_enum ## CLASS ##_valueForKey_table = nil;                                                                   \
+                                                                                                                                    \
+static id hr_enum ## CLASS ##_valueForKey_implementation(id SELF, SEL CMD, Class superclass, NSString *key)                         \
+{                                                                                                                                   \
+    id value = [hr_enum ## CLASS ##_valueForKey_table objectForKey: key];                                                           \
+                                                                                                                                    \
+    if (value == nil)                                                                                                               \
+    {                                                                                                                               \
+        struct objc_super superReceiver = { SELF, superclass };                                                                     \
+        value = ((id (*)(struct objc_super *, SEL, NSString *))objc_msgSendSuper)(&superReceiver, CMD, key);                        \
+    }                                                                                                                               \
+                                                                                                                                    \
+    return value;                                                                                                                   \
+}                                                                                                                                   \
+                                                                                                                                    \
+static id hr_enum ## CLASS ##_method_valueForKey_implementation(id SELF, SEL CMD, NSString *key)                                    \
+{                                                                                                                                   \
+    Class theClass = objc_getClass(# CLASS);                                                                                        \
+    return hr_enum ## CLASS ##_valueForKey_implementation(SELF, CMD, class_getSuperclass(theClass), key);                           \
+}                                                                                                                                   \
+                                                                                                                                    \
+static id hr_enum ## CLASS ##_classmethod_valueForKey_implementation(id SELF, SEL CMD, NSString *key)                               \
+{                                                                                                                                   \
+    Class metaClass = object_getClass(objc_getClass(# CLASS));                                                                      \
+    return hr_enum ## CLASS ##_valueForKey_implementation(SELF, CMD, class_getSuperclass(metaClass), key);                          \
+}                                                                                                                                   \
+                                                                                                                                    \
+__attribute__((unused))                                                                                                             \
+static void hr_enum_construct_ ## CLASS ##_valueForKey(void)                                                                        \
+{                                                                                                                                   \
+    Class theClass  = objc_getClass(# CLASS);                                                                                       \
+    Class metaClass = object_getClass(theClass);                                                                                    \
+                                                                                                                                    \
+    hr_enum ## CLASS ##_valueForKey_table = hr_enum ## CLASS ##_classmethod_asDictionary_implementation(theClass, NULL);            \
+                                                                                                                                    \
+    class_addMethod(theClass,  @selector(valueForKey:), (IMP)&hr_enum ## CLASS ##_method_valueForKey_implementation,      "@@:@");  \
+    class_addMethod(metaClass, @selector(valueForKey:), (IMP)&hr_enum ## CLASS ##_classmethod_valueForKey_implementation, "@@:@");  \
+};
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Numbers the enum constants in the order of declaration.
+//
+// Declares an anonymous enum with ordinals of the enum constants which can be used in constant expressions
+// (for example hr_enum_MyEnum_ordinal_Value1 for the MyEnumValue1 constant), MyEnum_count constant, a table of the
+// enum constants indexed by ordinal, and the MyEnum_ordinal/MyEnum_value functions which map enum constants to their
+// ordinals and back.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_ORDINALS(CLASS, ...)                                                                                \
+enum                                                                                                                \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_ORDINAL_ELEMENT, , CLASS, __VA_ARGS__)                                            \
+};                                                                                                                  \
+                                                                                                                    \
+enum                                                                                                                \
+{                                                                                                                   \
+    metamacro_concat(CLASS, _count) = 0 metamacro_foreach_cxt(HR_ENUM_COUNT_ELEMENT, , CLASS, __VA_ARGS__)          \
+};                                                                                                                  \
+                                                                                                                    \
+__attribute__((unused))                                                                                             \
+static const metamacro_concat(CLASS, _t) hr_enum_ ## CLASS ##_values[] =                                            \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_VALUES_ELEMENT, , CLASS, __VA_ARGS__)                                             \
+};                                                                                                                  \
+                                                                                                                    \
+static inline NSUInteger metamacro_concat(CLASS, _ordinal)(metamacro_concat(CLASS, _t) value)                       \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_ORDINAL_CASE, , CLASS, __VA_ARGS__)                                               \
+                                                                                                                    \
+    return NSNotFound;                                                                                              \
+}                                                                                                                   \
+                                                                                                                    \
+static inline metamacro_concat(CLASS, _t) metamacro_concat(CLASS, _value)(NSUInteger ordinal)                       \
+{                                                                                                                   \
+    return hr_enum_ ## CLASS ##_values[ordinal];                                                                    \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Helper macros to be used in conjunction with metamacro_foreach_cxt when iterating enum constants in
+// HR_ENUM_ORDINALS.
+//
+// Skip every parameter except the enum constant names, ordinal of the enum constant is the index of its name
+// divided by 3. Ordinal lookup is a chain of comparisons rather than a switch statement since the enum constants
+// may share the same value, which would make duplicate case labels.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_ORDINAL_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_ORDINAL_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_ORDINAL_ELEMENT_2(Index, CLASS, Name)
+#define HR_ENUM_ORDINAL_ELEMENT_1(Index, CLASS, Name)
+#define HR_ENUM_ORDINAL_ELEMENT_0(Index, CLASS, Name) \
+    hr_enum_ ## CLASS ##_ordinal_ ## Name = metamacro_div3(Index),
+
+
+#define HR_ENUM_COUNT_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_COUNT_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_COUNT_ELEMENT_2(Index, CLASS, Name)
+#define HR_ENUM_COUNT_ELEMENT_1(Index, CLASS, Name)
+#define HR_ENUM_COUNT_ELEMENT_0(Index, CLASS, Name) + 1
+
+
+#define HR_ENUM_VALUES_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_VALUES_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_VALUES_ELEMENT_2(Index, CLASS, Name)
+#define HR_ENUM_VALUES_ELEMENT_1(Index, CLASS, Name)
+#define HR_ENUM_VALUES_ELEMENT_0(Index, CLASS, Name) \
+    CLASS ## Name,
+
+
+#define HR_ENUM_ORDINAL_CASE(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_ORDINAL_CASE_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_ORDINAL_CASE_2(Index, CLASS, Name)
+#define HR_ENUM_ORDINAL_CASE_1(Index, CLASS, Name)
+#define HR_ENUM_ORDINAL_CASE_0(Index, CLASS, Name) \
+    if (value == CLASS ## Name) return metamacro_div3(Index);
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds a row of the transitions matrix to the HR_ENUM_TRANSITIONS table.
+//
+// This is a helper macro to be used in conjunction with metamacro_foreach_cxt when iterating HR_ENUM_TRANSITIONS
+// parameters. Every even parameter is a source enum constant name which becomes a designated initializer of its row,
+// every odd parameter is a parenthesized list of target constant names which are OR-ed into the row as bits.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_TRANSITIONS_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_TRANSITIONS_ELEMENT_, metamacro_is_even(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_TRANSITIONS_ELEMENT_1(Index, CLASS, Name) \
+    [hr_enum_ ## CLASS ##_ordinal_ ## Name] = 0
+
+#define HR_ENUM_TRANSITIONS_ELEMENT_0(Index, CLASS, Targets) \
+    metamacro_foreach_cxt_recursive(HR_ENUM_TRANSITION_TARGET, , CLASS, HR_ENUM_EXPAND Targets),
+
+#define HR_ENUM_TRANSITION_TARGET(Index, CLASS, Name) \
+    | (1ull << hr_enum_ ## CLASS ##_ordinal_ ## Name)
+
+#define HR_ENUM_EXPAND(...) __VA_ARGS__
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds an element to the HR_ENUM_ATTRIBUTE array.
+//
+// This is a helper macro to be used in conjunction with metamacro_foreach_cxt when iterating HR_ENUM_ATTRIBUTE
+// parameters. Every even parameter is an enum constant name which becomes a designated initializer, every odd
+// parameter is the attribute value.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_ATTRIBUTE_ELEMENT(Index, CLASS, Value) \
+    metamacro_concat(HR_ENUM_ATTRIBUTE_ELEMENT_, metamacro_is_even(Index))(Index, CLASS, Value)
+
+#define HR_ENUM_ATTRIBUTE_ELEMENT_1(Index, CLASS, Name) \
+    [hr_enum_ ## CLASS ##_ordinal_ ## Name] =
+
+#define HR_ENUM_ATTRIBUTE_ELEMENT_0(Index, CLASS, Value) \
+    Value,
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares MyEnum_strings function of the given enum class.
+//
+// Strings are stored in the hr_enum_MyEnum_strings table which is defined by SYNTHESIZE_HR_ENUM and filled in the
+// +initialize method of the enum class, so MyEnum_strings sends a message to the class if the table is not ready yet.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_STRINGS(CLASS, ...)                                                                                       \
+extern const HRSmartEnumStrings *hr_enum_ ## CLASS ##_strings;                                                            \
+                                                                                                                          \
+static inline const HRSmartEnumStrings *metamacro_concat(CLASS, _strings)(metamacro_concat(CLASS, _t) value)              \
+{                                                                                                                         \
+    const HRSmartEnumStrings *strings = __atomic_load_n(&hr_enum_ ## CLASS ##_strings, __ATOMIC_ACQUIRE);                 \
+    NSUInteger ordinal = metamacro_concat(CLASS, _ordinal)(value);                                                        \
+                                                                                                                          \
+    if (strings == NULL)                                                                                                  \
+    {                                                                                                                     \
+        [CLASS class];                                                                                                    \
+        strings = __atomic_load_n(&hr_enum_ ## CLASS ##_strings, __ATOMIC_ACQUIRE);                                       \
+    }                                                                                                                     \
+                                                                                                                          \
+    return (strings != NULL && ordinal < metamacro_concat(CLASS, _count)) ? &strings[ordinal] : NULL;                     \
+}                                                                                                                         \
+                                                                                                                          \
+__attribute__((unused))                                                                                                   \
+static void hr_enum_construct_ ## CLASS ##_strings(void)                                                                  \
+{                                                                                                                         \
+    static const char *const names[] = { metamacro_foreach_cxt(HR_ENUM_C_NAME_ELEMENT, , CLASS, __VA_ARGS__) };           \
+    const char *descriptions[metamacro_concat(CLASS, _count)];                                                            \
+                                                                                                                          \
+    @autoreleasepool                                                                                                      \
+    {                                                                                                                     \
+        NSDictionary *descriptionForValue = hr_enum ## CLASS ##_classmethod_nameForValue_implementation(nil, NULL);       \
+                                                                                                                          \
+        for (NSUInteger ordinal = 0; ordinal < metamacro_concat(CLASS, _count); ++ordinal)                                \
+        {                                                                                                                 \
+            descriptions[ordinal] = [descriptionForValue[@(hr_enum_ ## CLASS ##_values[ordinal])] UTF8String];            \
+        }                                                                                                                 \
+                                                                                                                          \
+        const HRSmartEnumStrings *strings = hr_enum_create_strings(metamacro_concat(CLASS, _count), names, descriptions); \
+        __atomic_store_n(&hr_enum_ ## CLASS ##_strings, strings, __ATOMIC_RELEASE);                                       \
+    }                                                                                                                     \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares MyEnum_localized_description function of the given enum class.
+//
+// Localized descriptions are stored in hr_enum_MyEnum_localization which is defined by SYNTHESIZE_HR_ENUM and
+// filled in the +initialize method of the enum class.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_LOCALIZED_DESCRIPTIONS(CLASS, ...)                                                                 \
+extern HRSmartEnumLocalization hr_enum_ ## CLASS ##_localization;                                                  \
+                                                                                                                   \
+static inline NSString *CLASS ## _localized_description(CLASS ## _t value)                                         \
+{                                                                                                                  \
+    const HRSmartEnumLocalizedDescriptions *table = __atomic_load_n(&hr_enum_ ## CLASS ##_localization.current,    \
+                                                                    __ATOMIC_ACQUIRE);                             \
+    NSUInteger ordinal = CLASS ## _ordinal(value);                                                                 \
+                                                                                                                   \
+    if (table == NULL)                                                                                             \
+    {                                                                                                              \
+        [CLASS class];                                                                                             \
+        table = __atomic_load_n(&hr_enum_ ## CLASS ##_localization.current, __ATOMIC_ACQUIRE);                     \
+    }                                                                                                              \
+                                                                                                                   \
+    return (table != NULL && ordinal < CLASS ## _count) ? (__bridge NSString *)table->descriptions[ordinal] : nil; \
+}                                                                                                                  \
+                                                                                                                   \
+__attribute__((unused))                                                                                            \
+static void hr_enum_ ## CLASS ##_load_localization(void)                                                           \
+{                                                                                                                  \
+    @autoreleasepool                                                                                               \
+    {                                                                                                              \
+        NSArray *descriptions = @[ metamacro_foreach_cxt(HR_ENUM_DESCRIPTION_ELEMENT, , CLASS, __VA_ARGS__) ];     \
+        HRSmartEnumLoadLocalizedDescriptions(&hr_enum_ ## CLASS ##_localization, descriptions);                    \
+    }                                                                                                              \
+}                                                                                                                  \
+                                                                                                                   \
+__attribute__((unused))                                                                                            \
+static void hr_enum_construct_ ## CLASS ##_localization(void)                                                      \
+{                                                                                                                  \
+    hr_enum_ ## CLASS ##_load_localization();                                                                      \
+                                                                                                                   \
+    [[NSNotificationCenter defaultCenter] addObserverForName: NSCurrentLocaleDidChangeNotification                 \
+                                                      object: nil                                                  \
+                                                       queue: nil                                                  \
+                                                  usingBlock: ^(NSNotification *notification) {                    \
+        hr_enum_ ## CLASS ##_load_localization();                                                                  \
+    }];                                                                                                            \
+}
+
+#define HR_ENUM_DESCRIPTION_ELEMENT(Index, CLASS, Description) \
+    metamacro_concat(HR_ENUM_DESCRIPTION_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Description)
+
+#define HR_ENUM_DESCRIPTION_ELEMENT_0(Index, CLASS, Description)
+#define HR_ENUM_DESCRIPTION_ELEMENT_1(Index, CLASS, Description)
+#define HR_ENUM_DESCRIPTION_ELEMENT_2(Index, CLASS, Description) \
+    @"" Description,
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds the enum constant name as a C string literal.
+//
+// This is a helper macro to be used in conjunction with metamacro_foreach_cxt when iterating enum constants.
+//
+// Skips every parameter except the enum constant names.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_C_NAME_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_C_NAME_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_C_NAME_ELEMENT_2(Index, CLASS, Name)
+#define HR_ENUM_C_NAME_ELEMENT_1(Index, CLASS, Name)
+#define HR_ENUM_C_NAME_ELEMENT_0(Index, CLASS, Name) \
+    # Name,
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares MyEnum_decode_column function of the given enum.
+//
+// Names of the enum constants are stored in a static table with lengths computed at compile time.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_DECODING(CLASS, ...)                                                                                \
+__attribute__((unused))                                                                                             \
+static const HRSmartEnumString hr_enum_ ## CLASS ##_names[] =                                                       \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_NAME_ELEMENT, , CLASS, __VA_ARGS__)                                               \
+};                                                                                                                  \
+                                                                                                                    \
+static inline size_t CLASS ## _decode_column(const char *bytes, size_t length, char separator, NSUInteger column,   \
+                                             CLASS ## _t *values, size_t capacity, uint64_t *invalidRows)           \
+{                                                                                                                   \
+    return HRSmartEnumDecodeColumn(hr_enum_ ## CLASS ##_names, (const NSInteger *)hr_enum_ ## CLASS ##_values,      \
+                                   CLASS ## _count, bytes, length, separator, column,                               \
+                                   (NSInteger *)values, capacity, invalidRows);                                     \
+}
+
+#define HR_ENUM_NAME_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_NAME_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_NAME_ELEMENT_2(Index, CLASS, Name)
+#define HR_ENUM_NAME_ELEMENT_1(Index, CLASS, Name)
+#define HR_ENUM_NAME_ELEMENT_0(Index, CLASS, Name) \
+    { # Name, sizeof(# Name) - 1 },
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares the schema fingerprint and remap functions of the given enum.
+//
+// Preprocessor cannot get at the characters of the constant names, so the fingerprint is computed from the static
+// names table declared by HR_ENUM_DECODING; all of its inputs are compile time constants, so the optimizer may fold
+// it into a constant as well.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_SCHEMA(CLASS)                                                                                       \
+static inline const HRSmartEnumString *CLASS ## _name(NSUInteger ordinal)                                           \
+{                                                                                                                   \
+    return &hr_enum_ ## CLASS ##_names[ordinal];                                                                    \
+}                                                                                                                   \
+                                                                                                                    \
+static inline uint64_t CLASS ## _fingerprint(void)                                                                  \
+{                                                                                                                   \
+    return HRSmartEnumFingerprint(hr_enum_ ## CLASS ##_names, (const NSInteger *)hr_enum_ ## CLASS ##_values,       \
+                                  CLASS ## _count);                                                                 \
+}                                                                                                                   \
+                                                                                                                    \
+static inline HRSmartEnumRemap *CLASS ## _remap_create(const HRSmartEnumString *storedNames,                        \
+                                                       const NSInteger *storedValues, NSUInteger storedCount)       \
+{                                                                                                                   \
+    return HRSmartEnumRemapCreate(storedNames, storedValues, storedCount, hr_enum_ ## CLASS ##_names,               \
+                                  (const NSInteger *)hr_enum_ ## CLASS ##_values, CLASS ## _count);                 \
+}                                                                                                                   \
+                                                                                                                    \
+static inline BOOL CLASS ## _remap(const HRSmartEnumRemap *remap, NSInteger storedValue, CLASS ## _t *value)        \
+{                                                                                                                   \
+    return HRSmartEnumRemapValue(remap, storedValue, (NSInteger *)value);                                           \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares the alias table type and weighted sampling functions of the given enum.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_SAMPLING(CLASS)                                                                                     \
+typedef struct                                                                                                      \
+{                                                                                                                   \
+    HRSmartEnumAliasSlot slots[CLASS ## _count];                                                                    \
+} CLASS ## _sampler_t;                                                                                              \
+                                                                                                                    \
+static inline BOOL CLASS ## _sampler_init(CLASS ## _sampler_t *sampler, const double *weights)                      \
+{                                                                                                                   \
+    return HRSmartEnumBuildAliasTable(weights, CLASS ## _count, sampler->slots);                                    \
+}                                                                                                                   \
+                                                                                                                    \
+static inline CLASS ## _t CLASS ## _sample(const CLASS ## _sampler_t *sampler, HRSmartEnumRandom *random)           \
+{                                                                                                                   \
+    return CLASS ## _value(HRSmartEnumSampleAliasTable(sampler->slots, CLASS ## _count, random));                   \
+}                                                                                                                   \
+                                                                                                                    \
+static inline void CLASS ## _sample_batch(const CLASS ## _sampler_t *sampler, HRSmartEnumRandom *random,            \
+                                          CLASS ## _t *values, size_t length)                                       \
+{                                                                                                                   \
+    HRSmartEnumRandom state = *random;                                                                              \
+                                                                                                                    \
+    for (size_t i = 0; i < length; ++i)                                                                             \
+    {                                                                                                               \
+        values[i] = CLASS ## _value(HRSmartEnumSampleAliasTable(sampler->slots, CLASS ## _count, &state));          \
+    }                                                                                                               \
+                                                                                                                    \
+    *random = state;                                                                                                \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares the memo table type and the lookup function of the given enum.
+//
+// Slots hold retained objects as plain pointers so that they could be accessed with atomic builtins.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_MEMO(CLASS)                                                                                         \
+typedef struct                                                                                                      \
+{                                                                                                                   \
+    void *slots[CLASS ## _count];                                                                                   \
+} CLASS ## _memo_t;                                                                                                 \
+                                                                                                                    \
+static inline id CLASS ## _memo(CLASS ## _memo_t *memo, CLASS ## _t value, id (^compute)(CLASS ## _t value))        \
+{                                                                                                                   \
+    NSUInteger ordinal = CLASS ## _ordinal(value);                                                                  \
+                                                                                                                    \
+    if (ordinal >= CLASS ## _count)                                                                                 \
+    {                                                                                                               \
+        return nil;                                                                                                 \
+    }                                                                                                               \
+                                                                                                                    \
+    void *object = __atomic_load_n(&memo->slots[ordinal], __ATOMIC_ACQUIRE);                                        \
+                                                                                                                    \
+    if (object == NULL)                                                                                             \
+    {                                                                                                               \
+        object = HRSmartEnumMemoInstall(&memo->slots[ordinal], compute(value));                                     \
+    }                                                                                                               \
+                                                                                                                    \
+    return (__bridge id)object;                                                                                     \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Escapes the given UTF-8 string as a JSON string literal contents (without the quotes).
+//
+// Returns the length of the escaped string; output may be NULL to compute the length only.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline size_t hr_enum_json_escape(const char *bytes, size_t length, char *output)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    size_t written = 0;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        unsigned char c = (unsigned char)bytes[i];
+        char escaped = 0;
+
+        switch (c)
+        {
+            case '"':  escaped = '"';  break;
+            case '\\': escaped = '\\'; break;
+            case '\b': escaped = 'b';  break;
+            case '\f': escaped = 'f';  break;
+            case '\n': escaped = 'n';  break;
+            case '\r': escaped = 'r';  break;
+            case '\t': escaped = 't';  break;
+        }
+
+        if (escaped != 0)
+        {
+            if (output != NULL)
+            {
+                output[written]   = '\\';
+                output[written+1] = escaped;
+            }
+            written += 2;
+        }
+        else if (c < 0x20)
+        {
+            if (output != NULL)
+            {
+                memcpy(output+written, "\\u00", 4);
+                output[written+4] = hexDigits[c >> 4];
+                output[written+5] = hexDigits[c & 0xf];
+            }
+            written += 6;
+        }
+        else
+        {
+            if (output != NULL)
+            {
+                output[written] = (char)c;
+            }
+            written += 1;
+        }
+    }
+
+    return written;
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Copies the given UTF-8 string to the position pointed by cursor (as a quoted JSON string literal if json is YES),
+// adds the terminating NUL and advances the cursor.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline HRSmartEnumString hr_enum_append_string(char **cursor, const char *bytes, BOOL json)
+{
+    HRSmartEnumString string = { *cursor, 0 };
+    size_t length = strlen(bytes);
+
+    if (json)
+    {
+        (*cursor)[0] = '"';
+        string.length = hr_enum_json_escape(bytes, length, *cursor+1) + 2;
+        (*cursor)[string.length-1] = '"';
+    }
+    else
+    {
+        memcpy(*cursor, bytes, length);
+        string.length = length;
+    }
+
+    (*cursor)[string.length] = '\0';
+    *cursor += string.length+1;
+
+    return string;
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Creates a table of HRSmartEnumStrings for the given enum constant names and descriptions (indexed by ordinal).
+//
+// The table and all of the strings it points to are allocated as a single block of memory which is never freed.
+// Returns NULL if the memory could not be allocated.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline const HRSmartEnumStrings *hr_enum_create_strings(NSUInteger count,
+                                                               const char *const *names,
+                                                               const char *const *descriptions)
+{
+    size_t size = count * sizeof(HRSmartEnumStrings);
+
+    for (NSUInteger i = 0; i < count; ++i)
+    {
+        size_t nameLength        = strlen(names[i]);
+        size_t descriptionLength = strlen(descriptions[i]);
+
+        size += nameLength + 1 + hr_enum_json_escape(names[i], nameLength, NULL) + 3;
+        size += descriptionLength + 1 + hr_enum_json_escape(descriptions[i], descriptionLength, NULL) + 3;
+    }
+
+    HRSmartEnumStrings *strings = malloc(size);
+
+    if (strings == NULL) return NULL;
+
+    char *cursor = (char *)(strings + count);
+
+    for (NSUInteger i = 0; i < count; ++i)
+    {
+        strings[i].name            = hr_enum_append_string(&cursor, names[i],        NO);
+        strings[i].jsonName        = hr_enum_append_string(&cursor, names[i],        YES);
+        strings[i].description     = hr_enum_append_string(&cursor, descriptions[i], NO);
+        strings[i].jsonDescription = hr_enum_append_string(&cursor, descriptions[i], YES);
+    }
+
+    return strings;
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares ordinal and value conversion tables and functions for HR_ENUM_MAPPING.
+//
+// Receives constants of the source enum as varargs after the <EnumName>_HR_ENUM_CONSTANTS macro is expanded.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_MAPPING_IMPLEMENTATION(From, To, ...)                                                               \
+__attribute__((unused))                                                                                             \
+static const NSUInteger hr_enum_ ## From ##_to_ ## To ##_ordinals[metamacro_concat(From, _count)] =                 \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_MAPPING_ORDINAL_ELEMENT, , To, __VA_ARGS__)                                       \
+};                                                                                                                  \
+                                                                                                                    \
+__attribute__((unused))                                                                                             \
+static const metamacro_concat(To, _t) hr_enum_ ## From ##_to_ ## To ##_values[metamacro_concat(From, _count)] =     \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_VALUES_ELEMENT, , To, __VA_ARGS__)                                                \
+};                                                                                                                  \
+                                                                                                                    \
+static inline NSUInteger From ##_to_ ## To ##_ordinal(NSUInteger ordinal)                                           \
+{                                                                                                                   \
+    return hr_enum_ ## From ##_to_ ## To ##_ordinals[ordinal];                                                      \
+}                                                                                                                   \
+                                                                                                                    \
+static inline BOOL From ##_to_ ## To ##_checked(metamacro_concat(From, _t) value, metamacro_concat(To, _t) *result) \
+{                                                                                                                   \
+    NSUInteger ordinal = metamacro_concat(From, _ordinal)(value);                                                   \
+                                                                                                                    \
+    if (ordinal >= metamacro_concat(From, _count)) return NO;                                                       \
+                                                                                                                    \
+    *result = hr_enum_ ## From ##_to_ ## To ##_values[ordinal];                                                     \
+    return YES;                                                                                                     \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Adds the ordinal of the destination enum constant with the same name to the HR_ENUM_MAPPING ordinals table.
+//
+// This is a helper macro to be used in conjunction with metamacro_foreach_cxt when iterating source enum constants.
+//
+// Skips every parameter except the enum constant names.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_MAPPING_ORDINAL_ELEMENT(Index, To, Name) \
+    metamacro_concat(HR_ENUM_MAPPING_ORDINAL_ELEMENT_, metamacro_rem3(Index))(Index, To, Name)
+
+#define HR_ENUM_MAPPING_ORDINAL_ELEMENT_2(Index, To, Name)
+#define HR_ENUM_MAPPING_ORDINAL_ELEMENT_1(Index, To, Name)
+#define HR_ENUM_MAPPING_ORDINAL_ELEMENT_0(Index, To, Name) \
+    hr_enum_ ## To ##_ordinal_ ## Name,
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares counting sort, partition and histogram functions of the given enum.
+//
+// Concurrent versions split the array into chunks, compute histograms of all chunks in parallel and then use them
+// to find the position of every element of every chunk in the result, so the result is stable just like the result
+// of the sequential versions.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_SORTING(CLASS)                                                                                       \
+static inline void CLASS ## _histogram(const CLASS ## _t *values, size_t length, size_t *counts)                     \
+{                                                                                                                    \
+    memset(counts, 0, (CLASS ## _count + 1) * sizeof(size_t));                                                       \
+                                                                                                                     \
+    for (size_t i = 0; i < length; ++i)                                                                              \
+    {                                                                                                                \
+        counts[MIN(CLASS ## _ordinal(values[i]), (NSUInteger)CLASS ## _count)] += 1;                                 \
+    }                                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void CLASS ## _counting_sort(CLASS ## _t *values, size_t length)                                       \
+{                                                                                                                    \
+    size_t counts[CLASS ## _count];                                                                                  \
+    size_t unknown = 0;                                                                                              \
+                                                                                                                     \
+    memset(counts, 0, sizeof(counts));                                                                               \
+                                                                                                                     \
+    for (size_t i = 0; i < length; ++i)                                                                              \
+    {                                                                                                                \
+        NSUInteger ordinal = CLASS ## _ordinal(values[i]);                                                           \
+                                                                                                                     \
+        if (ordinal < CLASS ## _count)                                                                               \
+        {                                                                                                            \
+            counts[ordinal] += 1;                                                                                    \
+        }                                                                                                            \
+        else                                                                                                         \
+        {                                                                                                            \
+            values[unknown++] = values[i];                                                                           \
+        }                                                                                                            \
+    }                                                                                                                \
+                                                                                                                     \
+    memmove(values + length - unknown, values, unknown * sizeof(CLASS ## _t));                                       \
+                                                                                                                     \
+    for (NSUInteger ordinal = 0, position = 0; ordinal < CLASS ## _count; ++ordinal)                                 \
+    {                                                                                                                \
+        CLASS ## _t value = CLASS ## _value(ordinal);                                                                \
+                                                                                                                     \
+        for (size_t i = 0; i < counts[ordinal]; ++i)                                                                 \
+        {                                                                                                            \
+            values[position++] = value;                                                                              \
+        }                                                                                                            \
+    }                                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void CLASS ## _partition(const CLASS ## _t *values, size_t length, size_t *indices, size_t *offsets)   \
+{                                                                                                                    \
+    size_t positions[CLASS ## _count + 1];                                                                           \
+                                                                                                                     \
+    CLASS ## _histogram(values, length, positions);                                                                  \
+    hr_enum_chunk_positions(positions, 1, CLASS ## _count + 1, offsets);                                             \
+                                                                                                                     \
+    for (size_t i = 0; i < length; ++i)                                                                              \
+    {                                                                                                                \
+        indices[positions[MIN(CLASS ## _ordinal(values[i]), (NSUInteger)CLASS ## _count)]++] = i;                    \
+    }                                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline size_t *hr_enum_ ## CLASS ##_chunk_histograms(const CLASS ## _t *values, size_t length, size_t chunks) \
+{                                                                                                                    \
+    size_t *histograms = malloc(chunks * (CLASS ## _count + 1) * sizeof(size_t));                                    \
+                                                                                                                     \
+    if (histograms == NULL) return NULL;                                                                             \
+                                                                                                                     \
+    dispatch_apply(chunks, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {          \
+        size_t begin = hr_enum_chunk_begin(length, chunks, chunk);                                                   \
+        size_t end   = hr_enum_chunk_begin(length, chunks, chunk+1);                                                 \
+                                                                                                                     \
+        CLASS ## _histogram(values + begin, end - begin, histograms + chunk * (CLASS ## _count + 1));                \
+    });                                                                                                              \
+                                                                                                                     \
+    return histograms;                                                                                               \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void CLASS ## _histogram_concurrent(const CLASS ## _t *values, size_t length, size_t *counts)          \
+{                                                                                                                    \
+    size_t  chunks     = hr_enum_chunk_count(length);                                                                \
+    size_t *histograms = hr_enum_ ## CLASS ##_chunk_histograms(values, length, chunks);                              \
+                                                                                                                     \
+    if (histograms == NULL)                                                                                          \
+    {                                                                                                                \
+        CLASS ## _histogram(values, length, counts);                                                                 \
+        return;                                                                                                      \
+    }                                                                                                                \
+                                                                                                                     \
+    memset(counts, 0, (CLASS ## _count + 1) * sizeof(size_t));                                                       \
+                                                                                                                     \
+    for (size_t chunk = 0; chunk < chunks; ++chunk)                                                                  \
+    {                                                                                                                \
+        for (size_t ordinal = 0; ordinal <= CLASS ## _count; ++ordinal)                                              \
+        {                                                                                                            \
+            counts[ordinal] += histograms[chunk * (CLASS ## _count + 1) + ordinal];                                  \
+        }                                                                                                            \
+    }                                                                                                                \
+                                                                                                                     \
+    free(histograms);                                                                                                \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void CLASS ## _counting_sort_concurrent(CLASS ## _t *values, size_t length)                            \
+{                                                                                                                    \
+    size_t        chunks    = hr_enum_chunk_count(length);                                                           \
+    size_t        offsets[CLASS ## _count + 2];                                                                      \
+    CLASS ## _t  *sorted    = malloc(length * sizeof(CLASS ## _t));                                                  \
+    size_t       *positions = NULL;                                                                                  \
+                                                                                                                     \
+    if (sorted != NULL) positions = hr_enum_ ## CLASS ##_chunk_histograms(values, length, chunks);                   \
+                                                                                                                     \
+    if (positions == NULL)                                                                                           \
+    {                                                                                                                \
+        free(sorted);                                                                                                \
+        CLASS ## _counting_sort(values, length);                                                                     \
+        return;                                                                                                      \
+    }                                                                                                                \
+                                                                                                                     \
+    hr_enum_chunk_positions(positions, chunks, CLASS ## _count + 1, offsets);                                        \
+                                                                                                                     \
+    dispatch_apply(chunks, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {          \
+        size_t *chunkPositions = positions + chunk * (CLASS ## _count + 1);                                          \
+        size_t  end            = hr_enum_chunk_begin(length, chunks, chunk+1);                                       \
+                                                                                                                     \
+        for (size_t i = hr_enum_chunk_begin(length, chunks, chunk); i < end; ++i)                                    \
+        {                                                                                                            \
+            sorted[chunkPositions[MIN(CLASS ## _ordinal(values[i]), (NSUInteger)CLASS ## _count)]++] = values[i];    \
+        }                                                                                                            \
+    });                                                                                                              \
+                                                                                                                     \
+    memcpy(values, sorted, length * sizeof(CLASS ## _t));                                                            \
+                                                                                                                     \
+    free(sorted);                                                                                                    \
+    free(positions);                                                                                                 \
+}                                                                                                                    \
+                                                                                                                     \
+static inline void CLASS ## _partition_concurrent(const CLASS ## _t *values, size_t length,                          \
+                                                  size_t *indices, size_t *offsets)                                  \
+{                                                                                                                    \
+    size_t  chunks    = hr_enum_chunk_count(length);                                                                 \
+    size_t *positions = hr_enum_ ## CLASS ##_chunk_histograms(values, length, chunks);                               \
+                                                                                                                     \
+    if (positions == NULL)                                                                                           \
+    {                                                                                                                \
+        CLASS ## _partition(values, length, indices, offsets);                                                       \
+        return;                                                                                                      \
+    }                                                                                                                \
+                                                                                                                     \
+    hr_enum_chunk_positions(positions, chunks, CLASS ## _count + 1, offsets);                                        \
+                                                                                                                     \
+    dispatch_apply(chunks, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {          \
+        size_t *chunkPositions = positions + chunk * (CLASS ## _count + 1);                                          \
+        size_t  end            = hr_enum_chunk_begin(length, chunks, chunk+1);                                       \
+                                                                                                                     \
+        for (size_t i = hr_enum_chunk_begin(length, chunks, chunk); i < end; ++i)                                    \
+        {                                                                                                            \
+            indices[chunkPositions[MIN(CLASS ## _ordinal(values[i]), (NSUInteger)CLASS ## _count)]++] = i;           \
+        }                                                                                                            \
+    });                                                                                                              \
+                                                                                                                     \
+    free(positions);                                                                                                 \
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns the number of chunks to split an array of the given length into for concurrent processing.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline size_t hr_enum_chunk_count(size_t length)
+{
+    const size_t minimumChunkLength = 1 << 16;
+    const size_t maximumChunks      = 4 * (size_t)[[NSProcessInfo processInfo] activeProcessorCount];
+
+    return MAX((size_t)1, MIN(length / minimumChunkLength, maximumChunks));
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Returns index of the first element of the given chunk when splitting an array into chunks of (almost) equal size.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline size_t hr_enum_chunk_begin(size_t length, size_t chunks, size_t chunk)
+{
+    return chunk * (length / chunks) + MIN(chunk, length % chunks);
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Converts the histograms of chunks (a chunks x buckets matrix with a row per chunk) into positions of the first
+// element of every bucket of every chunk in the array where the elements are grouped by bucket, keeping the order of
+// elements inside of every bucket. Positions where every bucket starts are written to offsets, which should have
+// buckets+1 elements; the last one is equal to the total number of elements.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+static inline void hr_enum_chunk_positions(size_t *histograms, size_t chunks, size_t buckets, size_t *offsets)
+{
+    size_t position = 0;
+
+    for (size_t bucket = 0; bucket < buckets; ++bucket)
+    {
+        offsets[bucket] = position;
+
+        for (size_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            size_t count = histograms[chunk * buckets + bucket];
+            histograms[chunk * buckets + bucket] = position;
+            position += count;
+        }
+    }
+
+    offsets[buckets] = position;
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Iterates the enum constants for HR_ENUM_FOREACH.
+//
+// HR_ENUM parameters are iterated in threes, the enum name, the user macro and its context are packed into a single
+// context parameter and unpacked for every enum constant.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_FOREACH_IMPLEMENTATION(CLASS, MACRO, Context, ...) \
+    metamacro_foreach3_cxt(HR_ENUM_FOREACH_ELEMENT, , (CLASS, MACRO, Context), __VA_ARGS__)
+
+#define HR_ENUM_FOREACH_ELEMENT(Index, Context, Name, Value, Description) \
+    HR_ENUM_FOREACH_CALL(Index, HR_ENUM_EXPAND Context, Name, Description)
+
+#define HR_ENUM_FOREACH_CALL(...) \
+    HR_ENUM_FOREACH_CALL_(__VA_ARGS__)
+
+#define HR_ENUM_FOREACH_CALL_(Index, CLASS, MACRO, Context, Name, Description) \
+    MACRO(Context, Index, Name, CLASS ## Name, @"" Description)
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Declares the sorted tables and range queries for HR_ENUM_RANGES.
+//
+// Position of every enum constant in the sorted tables (rank) is the number of the enum constants with smaller
+// values or the same value and smaller ordinals, which is computed as a sum of comparisons with every other constant.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_RANGES_IMPLEMENTATION(CLASS, ...)                                                                   \
+enum                                                                                                                \
+{                                                                                                                   \
+    metamacro_foreach3_cxt(HR_ENUM_RANK_ELEMENT, , (CLASS, __VA_ARGS__), __VA_ARGS__)                               \
+};                                                                                                                  \
+                                                                                                                    \
+__attribute__((unused))                                                                                             \
+static const NSInteger CLASS ## _sorted_values[CLASS ## _count] =                                                   \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_SORTED_VALUE_ELEMENT, , CLASS, __VA_ARGS__)                                       \
+};                                                                                                                  \
+                                                                                                                    \
+__attribute__((unused))                                                                                             \
+static const NSUInteger CLASS ## _sorted_ordinals[CLASS ## _count] =                                                \
+{                                                                                                                   \
+    metamacro_foreach_cxt(HR_ENUM_SORTED_ORDINAL_ELEMENT, , CLASS, __VA_ARGS__)                                     \
+};                                                                                                                  \
+                                                                                                                    \
+static inline NSUInteger CLASS ## _floor(NSInteger x)                                                               \
+{                                                                                                                   \
+    NSUInteger rank = hr_enum_count_less_or_equal(CLASS ## _sorted_values, CLASS ## _count, x);                     \
+    return (rank > 0) ? CLASS ## _sorted_ordinals[rank - 1] : NSNotFound;                                           \
+}                                                                                                                   \
+                                                                                                                    \
+static inline NSUInteger CLASS ## _ceil(NSInteger x)                                                                \
+{                                                                                                                   \
+    NSUInteger rank = hr_enum_count_less(CLASS ## _sorted_values, CLASS ## _count, x);                              \
+    return (rank < CLASS ## _count) ? CLASS ## _sorted_ordinals[rank] : NSNotFound;                                 \
+}                                                                                                                   \
+                                                                                                                    \
+static inline NSRange CLASS ## _range(NSInteger low, NSInteger high)                                                \
+{                                                                                                                   \
+    NSUInteger first = hr_enum_count_less(CLASS ## _sorted_values, CLASS ## _count, low);                           \
+    NSUInteger last  = hr_enum_count_less_or_equal(CLASS ## _sorted_values, CLASS ## _count, high);                 \
+                                                                                                                    \
+    return NSMakeRange(first, (last > first) ? last - first : 0);                                                   \
+}
+
+#define HR_ENUM_RANK_ELEMENT(Index, Context, Name, Value, Description) \
+    HR_ENUM_RANK(Name, HR_ENUM_EXPAND Context)
+
+#define HR_ENUM_RANK(...) \
+    HR_ENUM_RANK_(__VA_ARGS__)
+
+#define HR_ENUM_RANK_(Name, CLASS, ...) \
+    hr_enum_ ## CLASS ##_rank_ ## Name = 0 metamacro_foreach_cxt(HR_ENUM_RANK_TERM, , (CLASS, Name), __VA_ARGS__),
+
+#define HR_ENUM_RANK_TERM(Index, Context, Other) \
+    metamacro_concat(HR_ENUM_RANK_TERM_, metamacro_rem3(Index))(Other, HR_ENUM_EXPAND Context)
+
+#define HR_ENUM_RANK_TERM_0(...) \
+    HR_ENUM_RANK_LESS(__VA_ARGS__)
+
+#define HR_ENUM_RANK_TERM_1(...)
+#define HR_ENUM_RANK_TERM_2(...)
+
+#define HR_ENUM_RANK_LESS(Other, CLASS, Name) \
+    + ((CLASS ## Other < CLASS ## Name) ||    \
+       (CLASS ## Other == CLASS ## Name &&    \
+        hr_enum_ ## CLASS ##_ordinal_ ## Other < hr_enum_ ## CLASS ##_ordinal_ ## Name))
+
+#define HR_ENUM_SORTED_VALUE_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_SORTED_VALUE_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_SORTED_VALUE_ELEMENT_2(Index, CLASS, Name)
+#define HR_ENUM_SORTED_VALUE_ELEMENT_1(Index, CLASS, Name)
+#define HR_ENUM_SORTED_VALUE_ELEMENT_0(Index, CLASS, Name) \
+    [hr_enum_ ## CLASS ##_rank_ ## Name] = CLASS ## Name,
+
+#define HR_ENUM_SORTED_ORDINAL_ELEMENT(Index, CLASS, Name) \
+    metamacro_concat(HR_ENUM_SORTED_ORDINAL_ELEMENT_, metamacro_rem3(Index))(Index, CLASS, Name)
+
+#define HR_ENUM_SORTED_ORDINAL_ELEMENT_2(Index, CLASS, Name)
+#define HR_ENUM_SORTED_ORDINAL_ELEMENT_1(Index, CLASS, Name)
+#define HR_ENUM_SORTED_ORDINAL_ELEMENT_0(Index, CLASS, Name) \
+    [hr_enum_ ## CLASS ##_rank_ ## Name] = hr_enum_ ## CLASS ##_ordinal_ ## Name,
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Branchless binary search in a sorted array of at most 64 elements.
+//
+// Every step halves the number of candidates without a conditional jump, and there are as many steps as needed for
+// 64 elements, so when the count is a compile time constant the unnecessary steps are optimized away and the search
+// is fully unrolled.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_ENUM_BINARY_SEARCH_STEP(Comparison)                     \
+    if (count > 1)                                                 \
+    {                                                              \
+        NSUInteger half = count / 2;                               \
+        base  += (NSUInteger)(base[half - 1] Comparison x) * half; \
+        count -= half;                                             \
+    }
+
+#define HR_ENUM_BINARY_SEARCH(Comparison)                       \
+    const NSInteger *base = sorted;                             \
+                                                                \
+    HR_ENUM_BINARY_SEARCH_STEP(Comparison)                      \
+    HR_ENUM_BINARY_SEARCH_STEP(Comparison)                      \
+    HR_ENUM_BINARY_SEARCH_STEP(Comparison)                      \
+    HR_ENUM_BINARY_SEARCH_STEP(Comparison)                      \
+    HR_ENUM_BINARY_SEARCH_STEP(Comparison)                      \
+    HR_ENUM_BINARY_SEARCH_STEP(Comparison)                      \
+                                                                \
+    return (NSUInteger)(base - sorted) + (NSUInteger)((count > 0) && (*base Comparison x));
+
+// Returns the number of elements less than x.
+static inline NSUInteger hr_enum_count_less(const NSInteger *sorted, NSUInteger count, NSInteger x)
+{
+    HR_ENUM_BINARY_SEARCH(<)
+}
+
+// Returns the number of elements less than or equal to x.
+static inline NSUInteger hr_enum_count_less_or_equal(const NSInteger *sorted, NSUInteger count, NSInteger x)
+{
+    HR_ENUM_BINARY_SEARCH(<=)
+}
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Instrumentation of the enum class accessors, see HR_ENUM_INSTRUMENTATION.
+//
+// HR_ENUM_INSTRUMENTATION_IMPLEMENTATION is expanded inside the @implementation of the enum class by
+// SYNTHESIZE_HR_ENUM and defines the counters of the class, +instrumentationSnapshot and the instrumented versions
+// of +asDictionary and +descriptionForValue which replace the methods added by HR_ENUM_AS_DICTIONARY and
+// HR_ENUM_NAME_FOR_VALUE in +initialize. Counters keep the time in mach_absolute_time units which are converted to
+// nanoseconds when the snapshot is taken.
+//
+// HR_ENUM_INSTRUMENTATION_BEGIN and HR_ENUM_INSTRUMENTATION_END enclose the instrumented code within a method.
+//
+// All of the macros expand to nothing when the instrumentation is disabled.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if HR_ENUM_INSTRUMENTATION
+
+#define HR_ENUM_INSTRUMENTATION_INTERFACE \
++ (HRSmartEnumInstrumentationSnapshot) instrumentationSnapshot;
+
+#define HR_ENUM_INSTRUMENTATION_BEGIN() \
+    const uint64_t hr_enum_instrumentation_start = mach_absolute_time();
+
+#define HR_ENUM_INSTRUMENTATION_END(CLASS, Accessor, Objects)                                                        \
+    hr_enum_instrumentation_record(&hr_enum_ ## CLASS ##_instrumentation.accessors[HRSmartEnumAccessor ## Accessor], \
+                                   hr_enum_instrumentation_start, (Objects));
+
+#define HR_ENUM_INSTRUMENTATION_CONSTRUCT(CLASS) \
+    hr_enum_construct_ ## CLASS ##_instrumentation();
+
+#define HR_ENUM_INSTRUMENTATION_IMPLEMENTATION(CLASS)                                                \
+static HRSmartEnumInstrumentationSnapshot hr_enum_ ## CLASS ##_instrumentation;                      \
+                                                                                                     \
+static id hr_enum_ ## CLASS ##_instrumented_asDictionary(id SELF, SEL CMD, ...)                      \
+{                                                                                                    \
+    HR_ENUM_INSTRUMENTATION_BEGIN()                                                                  \
+    id asDictionary = hr_enum ## CLASS ##_classmethod_asDictionary_implementation(SELF, CMD);        \
+    HR_ENUM_INSTRUMENTATION_END(CLASS, AsDictionary, 1 + CLASS ## _count)                            \
+                                                                                                     \
+    return asDictionary;                                                                             \
+}                                                                                                    \
+                                                                                                     \
+static id hr_enum_ ## CLASS ##_instrumented_descriptionForValue(id SELF, SEL CMD, ...)               \
+{                                                                                                    \
+    HR_ENUM_INSTRUMENTATION_BEGIN()                                                                  \
+    id descriptionForValue = hr_enum ## CLASS ##_classmethod_nameForValue_implementation(SELF, CMD); \
+    HR_ENUM_INSTRUMENTATION_END(CLASS, DescriptionForValue, 1 + CLASS ## _count)                     \
+                                                                                                     \
+    return descriptionForValue;                                                                      \
+}                                                                                                    \
+                                                                                                     \
+static void hr_enum_construct_ ## CLASS ##_instrumentation(void)                                     \
+{                                                                                                    \
+    Class metaClass = object_getClass(objc_getClass(# CLASS));                                       \
+    class_replaceMethod(metaClass, @selector(asDictionary),                                          \
+                        &hr_enum_ ## CLASS ##_instrumented_asDictionary, "@@");                      \
+    class_replaceMethod(metaClass, @selector(descriptionForValue),                                   \
+                        &hr_enum_ ## CLASS ##_instrumented_descriptionForValue, "@@");               \
+}                                                                                                    \
+                                                                                                     \
++ (HRSmartEnumInstrumentationSnapshot) instrumentationSnapshot                                       \
+{                                                                                                    \
+    return hr_enum_instrumentation_snapshot(&hr_enum_ ## CLASS ##_instrumentation);                  \
+}
+
+static inline void hr_enum_instrumentation_record(HRSmartEnumAccessorCounters *counters, uint64_t start, uint64_t objects)
+{
+    __atomic_fetch_add(&counters->calls,       1,                          __ATOMIC_RELAXED);
+    __atomic_fetch_add(&counters->objects,     objects,                    __ATOMIC_RELAXED);
+    __atomic_fetch_add(&counters->nanoseconds, mach_absolute_time()-start, __ATOMIC_RELAXED);
+}
+
+static inline HRSmartEnumInstrumentationSnapshot
+hr_enum_instrumentation_snapshot(HRSmartEnumInstrumentationSnapshot *counters)
+{
+    HRSmartEnumInstrumentationSnapshot snapshot;
+    mach_timebase_info_data_t          timebase;
+
+    mach_timebase_info(&timebase);
+
+    for (NSUInteger i = 0; i < HRSmartEnumAccessorCount; ++i)
+    {
+        HRSmartEnumAccessorCounters *accessor = &counters->accessors[i];
+        uint64_t                     ticks    = __atomic_load_n(&accessor->nanoseconds, __ATOMIC_RELAXED);
+
+        snapshot.accessors[i].calls       = __atomic_load_n(&accessor->calls,   __ATOMIC_RELAXED);
+        snapshot.accessors[i].objects     = __atomic_load_n(&accessor->objects, __ATOMIC_RELAXED);
+        snapshot.accessors[i].nanoseconds = (uint64_t)((double)ticks * timebase.numer / timebase.denom);
+    }
+
+    return snapshot;
+}
+
+#else
+
+#define HR_ENUM_INSTRUMENTATION_INTERFACE
+#define HR_ENUM_INSTRUMENTATION_BEGIN()
+#define HR_ENUM_INSTRUMENTATION_END(CLASS, Accessor, Objects)
+#define HR_ENUM_INSTRUMENTATION_CONSTRUCT(CLASS)
+#define HR_ENUM_INSTRUMENTATION_IMPLEMENTATION(CLASS)
+
+#endif
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,586 @@
+//
+//  HRSmartEnum.m
+//  HRSmartEnum
+//
+//  Copyright (c) 2013 Sibers. All rights reserved.
+//  Released under the MIT license.
+//
+
+#import "HRSmartEnum.h"
+
+
+#pragma mark -
+#pragma mark Names index
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Open addressing hash table which maps enum constant names to ordinals.
+//
+// Slots contain ordinal+1 of the enum constant, 0 marks an empty slot. The table is kept at most half full, so
+// the lookups rarely have to probe more than a couple of slots.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#define HR_SMART_ENUM_NAME_SLOTS 1024
+
+typedef struct
+{
+    const HRSmartEnumString *names;
+    NSUInteger               mask;
+    uint16_t                 slots[HR_SMART_ENUM_NAME_SLOTS];
+} HRSmartEnumNamesIndex;
+
+
+// FNV-1a hash of the given bytes.
+static inline uint32_t HRSmartEnumHash(const char *bytes, size_t length)
+{
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        hash = (hash ^ (uint8_t)bytes[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+
+static void HRSmartEnumBuildNamesIndex(HRSmartEnumNamesIndex *index, const HRSmartEnumString *names, NSUInteger count)
+{
+    NSUInteger size = 16;
+
+    while (size < 2 * count)
+    {
+        size *= 2;
+    }
+
+    index->names = names;
+    index->mask  = size - 1;
+    memset(index->slots, 0, size * sizeof(index->slots[0]));
+
+    for (NSUInteger ordinal = 0; ordinal < count; ++ordinal)
+    {
+        NSUInteger slot = HRSmartEnumHash(names[ordinal].bytes, names[ordinal].length) & index->mask;
+
+        while (index->slots[slot] != 0)
+        {
+            slot = (slot + 1) & index->mask;
+        }
+
+        index->slots[slot] = (uint16_t)(ordinal + 1);
+    }
+}
+
+
+// Returns ordinal of the enum constant with the given name or NSNotFound.
+static inline NSUInteger HRSmartEnumLookupName(const HRSmartEnumNamesIndex *index, const char *bytes, size_t length)
+{
+    NSUInteger slot = HRSmartEnumHash(bytes, length) & index->mask;
+
+    while (index->slots[slot] != 0)
+    {
+        NSUInteger               ordinal = index->slots[slot] - 1;
+        const HRSmartEnumString *name    = &index->names[ordinal];
+
+        if ((name->length == length) && (memcmp(name->bytes, bytes, length) == 0))
+        {
+            return ordinal;
+        }
+
+        slot = (slot + 1) & index->mask;
+    }
+
+    return NSNotFound;
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Rows
+
+// Returns position of the first row which starts at or after the given position.
+static size_t HRSmartEnumRowStart(const char *bytes, size_t length, size_t position)
+{
+    if (position == 0 || position >= length)
+    {
+        return MIN(position, length);
+    }
+
+    const char *newline = memchr(bytes + position - 1, '\n', length - position + 1);
+    return (newline != NULL) ? (size_t)(newline - bytes) + 1 : length;
+}
+
+
+// Returns the number of rows in the given part of the buffer; the last row may lack the terminating '\n'.
+static size_t HRSmartEnumRowCount(const char *begin, const char *end)
+{
+    size_t rows = 0;
+
+    for (const char *newline; (begin < end) && (newline = memchr(begin, '\n', end - begin)) != NULL; begin = newline + 1)
+    {
+        rows += 1;
+    }
+
+    return (begin < end) ? rows + 1 : rows;
+}
+
+
+// Finds the given field of the row, removing "\r" line ending and enclosing double quotes. Returns NO if the row
+// does not have such a field.
+static inline BOOL HRSmartEnumFindField(const char *row, const char *rowEnd, char separator, NSUInteger column,
+                                        const char **field, size_t *length)
+{
+    const char *begin = row;
+
+    for (NSUInteger i = 0; i < column; ++i)
+    {
+        const char *next = memchr(begin, separator, rowEnd - begin);
+
+        if (next == NULL)
+        {
+            return NO;
+        }
+
+        begin = next + 1;
+    }
+
+    const char *end = memchr(begin, separator, rowEnd - begin);
+
+    if (end == NULL)
+    {
+        end = ((rowEnd > begin) && (rowEnd[-1] == '\r')) ? rowEnd - 1 : rowEnd;
+    }
+
+    if ((end - begin >= 2) && (*begin == '"') && (end[-1] == '"'))
+    {
+        begin += 1;
+        end   -= 1;
+    }
+
+    *field  = begin;
+    *length = (size_t)(end - begin);
+    return YES;
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Column decoding
+
+size_t HRSmartEnumDecodeColumn(const HRSmartEnumString *names, const NSInteger *values, NSUInteger count,
+                               const char *bytes, size_t length, char separator, NSUInteger column,
+                               NSInteger *output, size_t capacity, uint64_t *invalidRows)
+{
+    NSCParameterAssert(count < HR_SMART_ENUM_NAME_SLOTS / 2);
+
+    // The names index has a fixed size, so larger sets of names are rejected in release builds as well
+    if (count >= HR_SMART_ENUM_NAME_SLOTS / 2)
+    {
+        return 0;
+    }
+
+    size_t  chunks    = hr_enum_chunk_count(length);
+    size_t *starts    = malloc((chunks + 1) * sizeof(size_t));
+    size_t *firstRows = malloc((chunks + 1) * sizeof(size_t));
+
+    if (starts == NULL || firstRows == NULL)
+    {
+        free(firstRows);
+        free(starts);
+        return 0;
+    }
+
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+
+    for (size_t chunk = 0; chunk <= chunks; ++chunk)
+    {
+        starts[chunk] = HRSmartEnumRowStart(bytes, length, hr_enum_chunk_begin(length, chunks, chunk));
+    }
+
+    dispatch_apply(chunks, queue, ^(size_t chunk) {
+        firstRows[chunk+1] = HRSmartEnumRowCount(bytes + starts[chunk], bytes + starts[chunk+1]);
+    });
+
+    firstRows[0] = 0;
+
+    for (size_t chunk = 0; chunk < chunks; ++chunk)
+    {
+        firstRows[chunk+1] += firstRows[chunk];
+    }
+
+    size_t rows = firstRows[chunks];
+
+    if (rows <= capacity)
+    {
+        HRSmartEnumNamesIndex index;
+        HRSmartEnumBuildNamesIndex(&index, names, count);
+
+        if (invalidRows != NULL)
+        {
+            memset(invalidRows, 0, (rows + 63) / 64 * sizeof(uint64_t));
+        }
+
+        const HRSmartEnumNamesIndex *indexPointer = &index;
+
+        dispatch_apply(chunks, queue, ^(size_t chunk) {
+            const char *end = bytes + starts[chunk+1];
+            size_t      row = firstRows[chunk];
+
+            for (const char *begin = bytes + starts[chunk]; begin < end; ++row)
+            {
+                const char *newline = memchr(begin, '\n', end - begin);
+                const char *rowEnd  = (newline != NULL) ? newline : end;
+                const char *field   = NULL;
+                size_t      fieldLength = 0;
+                NSUInteger  ordinal = NSNotFound;
+
+                if (HRSmartEnumFindField(begin, rowEnd, separator, column, &field, &fieldLength))
+                {
+                    ordinal = HRSmartEnumLookupName(indexPointer, field, fieldLength);
+                }
+
+                if (ordinal != NSNotFound)
+                {
+                    output[row] = values[ordinal];
+                }
+                else if (invalidRows != NULL)
+                {
+                    // Chunks share the bitmap words at their boundaries
+                    __atomic_fetch_or(&invalidRows[row / 64], 1ull << (row % 64), __ATOMIC_RELAXED);
+                }
+
+                begin = (newline != NULL) ? newline + 1 : end;
+            }
+        });
+    }
+
+    free(firstRows);
+    free(starts);
+
+    return rows;
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Random sampling
+
+void HRSmartEnumRandomSeed(HRSmartEnumRandom *random, uint64_t seed)
+{
+    // State is filled with splitmix64 outputs, so that similar seeds produce unrelated states
+    for (NSUInteger i = 0; i < 4; ++i)
+    {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+
+        random->state[i] = z ^ (z >> 31);
+    }
+}
+
+
+BOOL HRSmartEnumBuildAliasTable(const double *weights, NSUInteger count, HRSmartEnumAliasSlot *slots)
+{
+    double     total    = 0;
+    NSUInteger heaviest = 0;
+
+    for (NSUInteger i = 0; i < count; ++i)
+    {
+        // Also rejects NaN weights
+        if (!(weights[i] >= 0)) return NO;
+
+        total += weights[i];
+
+        if (weights[i] > weights[heaviest])
+        {
+            heaviest = i;
+        }
+    }
+
+    // All-zero weights would make every probability NaN, and infinite ones every probability but one
+    if (!(total > 0) || isinf(total)) return NO;
+
+    double     probabilities[count];
+    NSUInteger small[count];
+    NSUInteger large[count];
+    NSUInteger smallCount = 0;
+    NSUInteger largeCount = 0;
+
+    for (NSUInteger i = 0; i < count; ++i)
+    {
+        probabilities[i] = weights[i] * count / total;
+
+        if (probabilities[i] < 1)
+        {
+            small[smallCount++] = i;
+        }
+        else
+        {
+            large[largeCount++] = i;
+        }
+    }
+
+    while (smallCount > 0 && largeCount > 0)
+    {
+        NSUInteger less = small[--smallCount];
+        NSUInteger more = large[--largeCount];
+
+        slots[less].threshold = (uint32_t)(probabilities[less] * 4294967296.0);
+        slots[less].alias     = (uint32_t)more;
+
+        probabilities[more] -= 1 - probabilities[less];
+
+        if (probabilities[more] < 1)
+        {
+            small[smallCount++] = more;
+        }
+        else
+        {
+            large[largeCount++] = more;
+        }
+    }
+
+    // Whatever is left has probability of 1 up to rounding errors
+    while (largeCount > 0)
+    {
+        NSUInteger index = large[--largeCount];
+        slots[index] = (HRSmartEnumAliasSlot){ UINT32_MAX, (uint32_t)index };
+    }
+
+    // Constants with zero weight can be left here by rounding errors as well, but they should never be sampled,
+    // so their slots always return a constant with non-zero weight instead
+    while (smallCount > 0)
+    {
+        NSUInteger index = small[--smallCount];
+
+        if (weights[index] > 0)
+        {
+            slots[index] = (HRSmartEnumAliasSlot){ UINT32_MAX, (uint32_t)index };
+        }
+        else
+        {
+            slots[index] = (HRSmartEnumAliasSlot){ 0, (uint32_t)heaviest };
+        }
+    }
+
+    return YES;
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Schema remapping
+
+typedef struct
+{
+    NSInteger  storedValue;
+    NSInteger  value;
+    NSUInteger storedOrdinal;
+} HRSmartEnumRemapEntry;
+
+
+// Only the stored constants which still exist have entries. Entries are sorted by the stored value for the binary
+// search, entries with the same stored value are sorted by the stored ordinal, so the first of them is found.
+struct HRSmartEnumRemap
+{
+    NSUInteger            count;
+    HRSmartEnumRemapEntry entries[];
+};
+
+
+static int HRSmartEnumCompareRemapEntries(const void *entry1, const void *entry2)
+{
+    const HRSmartEnumRemapEntry *first  = entry1;
+    const HRSmartEnumRemapEntry *second = entry2;
+
+    if (first->storedValue != second->storedValue)
+    {
+        return (first->storedValue > second->storedValue) ? 1 : -1;
+    }
+
+    return (first->storedOrdinal > second->storedOrdinal) - (first->storedOrdinal < second->storedOrdinal);
+}
+
+
+HRSmartEnumRemap *HRSmartEnumRemapCreate(const HRSmartEnumString *storedNames, const NSInteger *storedValues,
+                                         NSUInteger storedCount, const HRSmartEnumString *names,
+                                         const NSInteger *values, NSUInteger count)
+{
+    NSCParameterAssert(count < HR_SMART_ENUM_NAME_SLOTS / 2);
+
+    if (count >= HR_SMART_ENUM_NAME_SLOTS / 2)
+    {
+        return NULL;
+    }
+
+    HRSmartEnumRemap *remap = malloc(sizeof(HRSmartEnumRemap) + storedCount * sizeof(HRSmartEnumRemapEntry));
+
+    if (remap == NULL)
+    {
+        return NULL;
+    }
+
+    HRSmartEnumNamesIndex index;
+    HRSmartEnumBuildNamesIndex(&index, names, count);
+
+    remap->count = 0;
+
+    for (NSUInteger i = 0; i < storedCount; ++i)
+    {
+        NSUInteger ordinal = HRSmartEnumLookupName(&index, storedNames[i].bytes, storedNames[i].length);
+
+        if (ordinal != NSNotFound)
+        {
+            remap->entries[remap->count++] = (HRSmartEnumRemapEntry){ storedValues[i], values[ordinal], i };
+        }
+    }
+
+    qsort(remap->entries, remap->count, sizeof(HRSmartEnumRemapEntry), HRSmartEnumCompareRemapEntries);
+
+    return remap;
+}
+
+
+BOOL HRSmartEnumRemapValue(const HRSmartEnumRemap *remap, NSInteger storedValue, NSInteger *value)
+{
+    NSUInteger low  = 0;
+    NSUInteger high = remap->count;
+
+    while (low < high)
+    {
+        NSUInteger middle = low + (high-low)/2;
+
+        if (remap->entries[middle].storedValue < storedValue)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if ((low < remap->count) && (remap->entries[low].storedValue == storedValue))
+    {
+        *value = remap->entries[low].value;
+        return YES;
+    }
+
+    return NO;
+}
+
+
+void HRSmartEnumRemapFree(HRSmartEnumRemap *remap)
+{
+    free(remap);
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Memoization
+
+void *HRSmartEnumMemoInstall(void **slot, id object)
+{
+    void *retained = (void *)CFBridgingRetain(object);
+    void *expected = NULL;
+
+    if (retained == NULL)
+    {
+        return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+    }
+
+    if (__atomic_compare_exchange_n(slot, &expected, retained, NO, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        return retained;
+    }
+
+    // Another thread has filled the slot first
+    CFRelease(retained);
+    return expected;
+}
+
+
+
+
+
+#pragma mark -
+#pragma mark Localized descriptions
+
+static const HRSmartEnumLocalizedDescriptions *HRSmartEnumFindLocalizedDescriptions(
+    const HRSmartEnumLocalizedDescriptions *table, const HRSmartEnumLocalizedDescriptions *end, NSString *localization)
+{
+    for (; table != end; table = table->next)
+    {
+        if ([(__bridge NSString *)table->localization isEqualToString: localization]) return table;
+    }
+
+    return NULL;
+}
+
+
+void HRSmartEnumLoadLocalizedDescriptions(HRSmartEnumLocalization *localization, NSArray *descriptions)
+{
+    NSBundle *bundle    = [NSBundle mainBundle];
+    NSString *preferred = [NSBundle preferredLocalizationsFromArray: bundle.localizations
+                                                     forPreferences: [NSLocale preferredLanguages]].firstObject ?: @"";
+
+    const HRSmartEnumLocalizedDescriptions *loaded = __atomic_load_n(&localization->loaded, __ATOMIC_ACQUIRE);
+    const HRSmartEnumLocalizedDescriptions *table  = HRSmartEnumFindLocalizedDescriptions(loaded, NULL, preferred);
+
+    if (table == NULL)
+    {
+        NSUInteger count = descriptions.count;
+        HRSmartEnumLocalizedDescriptions *created = malloc(sizeof(HRSmartEnumLocalizedDescriptions) +
+                                                           count * sizeof(CFStringRef));
+
+        if (created == NULL) return;
+
+        // NSLocalizedString keeps using the localization chosen at launch, so look the strings up
+        // in the .lproj directory of the preferred localization directly
+        NSString *path            = (preferred.length > 0) ? [bundle pathForResource: preferred ofType: @"lproj"] : nil;
+        NSBundle *localizedBundle = (path != nil) ? [NSBundle bundleWithPath: path] : nil;
+
+        if (localizedBundle == nil) localizedBundle = bundle;
+
+        created->localization = CFBridgingRetain(preferred);
+
+        for (NSUInteger i = 0; i < count; ++i)
+        {
+            created->descriptions[i] = CFBridgingRetain([localizedBundle localizedStringForKey: descriptions[i]
+                                                                                         value: descriptions[i]
+                                                                                         table: nil]);
+        }
+
+        created->next = loaded;
+
+        while (!__atomic_compare_exchange_n(&localization->loaded, &loaded, created, NO,
+                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        {
+            // Another thread has loaded a table first, it may be for the same localization
+            table = HRSmartEnumFindLocalizedDescriptions(loaded, created->next, preferred);
+
+            if (table != NULL)
+            {
+                for (NSUInteger i = 0; i < count; ++i) CFRelease(created->descriptions[i]);
+                CFRelease(created->localization);
+                free(created);
+                break;
+            }
+
+            created->next = loaded;
+        }
+
+        if (table == NULL) table = created;
+    }
+
+    __atomic_store_n(&localization->current, table, __ATOMIC_RELEASE);
+}
@@ -9,6 +9,7 @@
 
 #import <Foundation/Foundation.h>
 #import "HRSmartEnum.h"
+#import "HRRuntimeEnum.h"
 
 
 // Using HR_ENUM macro you declare both a plain C enum with the given name
@@ -75,6 +76,16 @@
 @SYNTHESIZE_HR_ENUM(MahBoi);
 
 
+// Enum constants may share the same value, in which case the ordinal
+// lookup maps the value to the first of them.
+@HR_ENUM(Priority,
+         Default, 0, @"Default priority",
+         Low,     0, @"Low priority which is currently the same as the default one",
+         High,    1, @"High priority");
+
+@SYNTHESIZE_HR_ENUM(Priority);
+
+
 int main(int argc, const char * argv[])
 {
     @autoreleasepool {
@@ -134,6 +145,69 @@ int main(int argc, const char * argv[])
         // is also available as a class and instance methods
         NSLog(@"MahBoi.nameForValue = %@", MahBoi.descriptionForValue);
         NSLog(@"boi.nameForValue = %@", boi.descriptionForValue);
+
+
+        // Names and descriptions are also available as pre-encoded UTF-8
+        // and JSON strings which can be written out as is.
+        const HRSmartEnumStrings *strings = MahBoi_strings(MahBoiValue3);
+        fwrite(strings->jsonName.bytes,        1, strings->jsonName.length,        stdout);
+        fwrite(":",                            1, 1,                               stdout);
+        fwrite(strings->jsonDescription.bytes, 1, strings->jsonDescription.length, stdout);
+        fwrite("\n",                           1, 1,                               stdout);
+
+
+        // Localized descriptions are resolved once for the current locale
+        // and served from an ordinal-indexed table afterwards.
+        NSLog(@"localized description of MahBoiValue3 = %@", MahBoi_localized_description(MahBoiValue3));
+
+
+        // PriorityLow has the same value as PriorityDefault, so both of them
+        // have ordinal of PriorityDefault.
+        NSLog(@"Priority_ordinal(PriorityLow) = %lu", (unsigned long)Priority_ordinal(PriorityLow));
+
+
+        // Enum constants are also available through KVC. The enum class
+        // overrides valueForKey: so that constant names are served from a
+        // cached name table with pre-boxed values, which is a lot faster than
+        // the generic KVC accessor search NSObject performs.
+        NSLog(@"[boi valueForKey: @\"Value3\"] = %@", [boi valueForKey: @"Value3"]);
+
+
+        // Enum constants can also be represented by instances of the enum
+        // class. There is a single immortal instance per constant, so
+        // getting one never allocates and the instances can be compared
+        // by pointer or used as dictionary keys.
+        MahBoi *value3 = [MahBoi enumWithValue: MahBoiValue3];
+        NSLog(@"value3.enumValue = %ld, same instance: %d", value3.enumValue,
+              value3 == [MahBoi enumWithValue: MahBoiValue3]);
+
+
+#if HR_ENUM_INSTRUMENTATION
+        // With HR_ENUM_INSTRUMENTATION enabled, the enum class counts calls,
+        // allocated objects and time spent in its allocating accessors.
+        HRSmartEnumAccessorCounters asDictionary = [MahBoi instrumentationSnapshot].accessors[HRSmartEnumAccessorAsDictionary];
+        NSLog(@"MahBoi.asDictionary: %llu calls, %llu objects, %llu ns",
+              asDictionary.calls, asDictionary.objects, asDictionary.nanoseconds);
+#endif
+
+
+        // Enums which are defined by configuration rather than code can be
+        // loaded at runtime from a metadata file, the resulting class has
+        // the same methods as the classes declared with HR_ENUM.
+        NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent: @"FeatureTier.hrenum"];
+
+        [[HRRuntimeEnum dataWithClassName: @"FeatureTier"
+                                    names: @[ @"Free", @"Pro", @"Enterprise" ]
+                                   values: @[ @0, @10, @20 ]
+                             descriptions: @[ @"Free tier", @"Professional tier", @"" ]] writeToFile: path
+                                                                                       atomically: YES];
+
+        NSError *error = nil;
+        Class FeatureTier = [HRRuntimeEnum enumClassWithContentsOfFile: path error: &error];
+
+        NSLog(@"FeatureTier.asDictionary = %@", [FeatureTier asDictionary]);
+        NSLog(@"[FeatureTier valueForKey: @\"Pro\"] = %@", [FeatureTier valueForKey: @"Pro"]);
+        NSLog(@"FeatureTier name for 20 = %s", HRRuntimeEnumNameForValue(FeatureTier, 20).bytes);
     }
     
     return 0;